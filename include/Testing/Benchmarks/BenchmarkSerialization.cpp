@@ -0,0 +1,322 @@
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/serialization_macros.h"
+#include "serialization.h"
+#include "serialization_impl.h"
+#include "util/multi_process_stream.h"
+#include "util/pointer.h"
+
+//=============================================================================
+// Benchmark Payloads
+//=============================================================================
+
+namespace serialization
+{
+// Wide flat struct: many scalar members, the shape of a trade record.
+class bench_wide_trade
+{
+public:
+    bench_wide_trade() = default;
+
+    double      price{0};
+    double      quantity{0};
+    double      notional{0};
+    double      accrued{0};
+    double      spread{0};
+    double      fx_rate{0};
+    int64_t     trade_time{0};
+    int64_t     settle_time{0};
+    int32_t     venue{0};
+    int32_t     account{0};
+    std::string symbol;
+    std::string counterparty;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(
+        bench_wide_trade,
+        price,
+        quantity,
+        notional,
+        accrued,
+        spread,
+        fx_rate,
+        trade_time,
+        settle_time,
+        venue,
+        account,
+        symbol,
+        counterparty);
+
+    friend struct serialization::access::serializer;
+};
+
+// Deep graph node: each node owns the next through a shared_ptr, so the
+// serializers walk one pointer-chasing chain per archive.
+class bench_graph_node
+{
+public:
+    bench_graph_node() = default;
+
+    double                            value{0};
+    std::string                       label;
+    std::shared_ptr<bench_graph_node> next;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(bench_graph_node, value, label, next);
+
+    friend struct serialization::access::serializer;
+};
+
+// Bulk numeric payload: a single contiguous vector<double>, the shape
+// that hits the memcpy block paths in every archiver.
+class bench_double_block
+{
+public:
+    bench_double_block() = default;
+
+    std::vector<double> values;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(bench_double_block, values);
+
+    friend struct serialization::access::serializer;
+};
+
+// A book of wide trade records, walked element by element.
+class bench_trade_book
+{
+public:
+    bench_trade_book() = default;
+
+    std::vector<bench_wide_trade> trades;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(bench_trade_book, trades);
+
+    friend struct serialization::access::serializer;
+};
+
+// Associative payload: string-keyed curve pillars.
+class bench_curve
+{
+public:
+    bench_curve() = default;
+
+    std::map<std::string, double> pillars;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(bench_curve, pillars);
+
+    friend struct serialization::access::serializer;
+};
+}  // namespace serialization
+
+namespace
+{
+using serialization::serialization_impl::access;
+
+//----------------------------------------------------------------------------
+serialization::ptr_const<serialization::bench_double_block> make_doubles(size_t count)
+{
+    auto block = std::make_shared<serialization::bench_double_block>();
+    block->values.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        block->values[i] = static_cast<double>(i) * 0.25 - 1000.0;
+    }
+    return block;
+}
+
+//----------------------------------------------------------------------------
+serialization::ptr_const<serialization::bench_trade_book> make_trades(size_t count)
+{
+    auto book = std::make_shared<serialization::bench_trade_book>();
+    book->trades.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto& trade        = book->trades[i];
+        trade.price        = static_cast<double>(i) + 0.5;
+        trade.quantity     = static_cast<double>(i % 1000);
+        trade.notional     = trade.price * trade.quantity;
+        trade.trade_time   = static_cast<int64_t>(i) * 1000;
+        trade.settle_time  = trade.trade_time + 86400;
+        trade.venue        = static_cast<int32_t>(i % 7);
+        trade.account      = static_cast<int32_t>(i % 31);
+        trade.symbol       = "SYM" + std::to_string(i % 64);
+        trade.counterparty = "CPTY" + std::to_string(i % 16);
+    }
+    return book;
+}
+
+//----------------------------------------------------------------------------
+serialization::ptr_const<serialization::bench_graph_node> make_graph(size_t depth)
+{
+    std::shared_ptr<serialization::bench_graph_node> head;
+    for (size_t i = 0; i < depth; ++i)
+    {
+        auto node   = std::make_shared<serialization::bench_graph_node>();
+        node->value = static_cast<double>(i);
+        node->label = "node" + std::to_string(i);
+        node->next  = head;
+        head        = node;
+    }
+    return head;
+}
+
+//----------------------------------------------------------------------------
+serialization::ptr_const<serialization::bench_curve> make_curve(size_t count)
+{
+    auto curve = std::make_shared<serialization::bench_curve>();
+    for (size_t i = 0; i < count; ++i)
+    {
+        curve->pillars["pillar" + std::to_string(i)] = static_cast<double>(i) * 0.01;
+    }
+    return curve;
+}
+
+//=============================================================================
+// Round-trip benchmarks: one body per archiver, parameterized over the
+// payload builders above. ns/op comes from the timer, bytes/op from the
+// archive size counter.
+//=============================================================================
+
+template <typename T>
+void binary_round_trip(benchmark::State& state, const serialization::ptr_const<T>& obj)
+{
+    int64_t archive_bytes = 0;
+    for (auto _ : state)
+    {
+        const auto bytes  = access::binary_serialize(obj);
+        auto       loaded = access::binary_deserialize<T>(bytes);
+        benchmark::DoNotOptimize(loaded);
+        archive_bytes = static_cast<int64_t>(bytes.size());
+    }
+    state.SetBytesProcessed(state.iterations() * archive_bytes);
+    state.counters["archive_bytes"] = static_cast<double>(archive_bytes);
+}
+
+template <typename T>
+void json_round_trip(benchmark::State& state, const serialization::ptr_const<T>& obj)
+{
+    int64_t archive_bytes = 0;
+    for (auto _ : state)
+    {
+        serialization::json value;
+        access::json_serialize(value, obj);
+        serialization::ptr_const<T> loaded;
+        access::json_deserialize(value, loaded);
+        benchmark::DoNotOptimize(loaded);
+        archive_bytes = static_cast<int64_t>(value.dump().size());
+    }
+    state.SetBytesProcessed(state.iterations() * archive_bytes);
+    state.counters["archive_bytes"] = static_cast<double>(archive_bytes);
+}
+
+template <typename T>
+void xml_round_trip(benchmark::State& state, const serialization::ptr_const<T>& obj)
+{
+    for (auto _ : state)
+    {
+        pugi::xml_document doc;
+        access::xml_serialize(doc, obj);
+        serialization::ptr_const<T> loaded;
+        access::xml_deserialize(doc, loaded);
+        benchmark::DoNotOptimize(loaded);
+    }
+}
+
+//----------------------------------------------------------------------------
+void BM_Binary_VectorDouble(benchmark::State& state)
+{
+    binary_round_trip(state, make_doubles(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Json_VectorDouble(benchmark::State& state)
+{
+    json_round_trip(state, make_doubles(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Xml_VectorDouble(benchmark::State& state)
+{
+    xml_round_trip(state, make_doubles(static_cast<size_t>(state.range(0))));
+}
+
+//----------------------------------------------------------------------------
+void BM_Binary_WideTrades(benchmark::State& state)
+{
+    binary_round_trip(state, make_trades(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Json_WideTrades(benchmark::State& state)
+{
+    json_round_trip(state, make_trades(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Xml_WideTrades(benchmark::State& state)
+{
+    xml_round_trip(state, make_trades(static_cast<size_t>(state.range(0))));
+}
+
+//----------------------------------------------------------------------------
+void BM_Binary_DeepGraph(benchmark::State& state)
+{
+    binary_round_trip(state, make_graph(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Json_DeepGraph(benchmark::State& state)
+{
+    json_round_trip(state, make_graph(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Xml_DeepGraph(benchmark::State& state)
+{
+    xml_round_trip(state, make_graph(static_cast<size_t>(state.range(0))));
+}
+
+//----------------------------------------------------------------------------
+void BM_Binary_StringDoubleMap(benchmark::State& state)
+{
+    binary_round_trip(state, make_curve(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Json_StringDoubleMap(benchmark::State& state)
+{
+    json_round_trip(state, make_curve(static_cast<size_t>(state.range(0))));
+}
+
+void BM_Xml_StringDoubleMap(benchmark::State& state)
+{
+    xml_round_trip(state, make_curve(static_cast<size_t>(state.range(0))));
+}
+
+// Million-element numeric payloads stress the bulk/block paths; the
+// smaller steps show where per-element overhead takes over.
+BENCHMARK(BM_Binary_VectorDouble)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Json_VectorDouble)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_Xml_VectorDouble)->RangeMultiplier(32)->Range(1 << 10, 1 << 15);
+
+BENCHMARK(BM_Binary_WideTrades)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK(BM_Json_WideTrades)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK(BM_Xml_WideTrades)->RangeMultiplier(8)->Range(64, 512);
+
+// Depth stays under the context's cycle-guard limit of 1000.
+BENCHMARK(BM_Binary_DeepGraph)->RangeMultiplier(4)->Range(32, 512);
+BENCHMARK(BM_Json_DeepGraph)->RangeMultiplier(4)->Range(32, 512);
+BENCHMARK(BM_Xml_DeepGraph)->RangeMultiplier(4)->Range(32, 512);
+
+BENCHMARK(BM_Binary_StringDoubleMap)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK(BM_Json_StringDoubleMap)->RangeMultiplier(8)->Range(64, 4096);
+BENCHMARK(BM_Xml_StringDoubleMap)->RangeMultiplier(8)->Range(64, 512);
+}  // namespace
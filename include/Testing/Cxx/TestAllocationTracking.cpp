@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/serialization_macros.h"
+#include "serialization.h"
+#include "serialization_impl.h"
+#include "support/allocation_tracker.h"
+#include "util/multi_process_stream.h"
+
+//=============================================================================
+// Test Classes
+//=============================================================================
+
+namespace serialization
+{
+// Padding-free scalar record eligible for the memcpy fast path.
+class alloc_tick_record
+{
+public:
+    alloc_tick_record() = default;
+
+    double  price{0};
+    double  volume{0};
+    int64_t timestamp{0};
+    int32_t venue{0};
+    int32_t flags{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(alloc_tick_record, price, volume, timestamp, venue, flags);
+
+    friend struct serialization::access::serializer;
+};
+
+// Record with a string member, so saves walk element by element and
+// loads construct one string per element.
+class alloc_position
+{
+public:
+    alloc_position() = default;
+
+    std::string symbol;
+    double      quantity{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(alloc_position, symbol, quantity);
+
+    friend struct serialization::access::serializer;
+};
+}  // namespace serialization
+
+//=============================================================================
+// Test Fixture
+//=============================================================================
+
+// Budgets catch allocation regressions mechanically: each case runs the
+// operation once to warm lazily built state (plans, registries, interned
+// tables), then asserts the steady-state allocation count stays under a
+// budget with roughly 2x headroom over the measured baseline. A breach
+// means a hot path started allocating per element or per call.
+class AllocationTrackingTest : public ::testing::Test
+{
+};
+
+//=============================================================================
+// Test Cases
+//=============================================================================
+
+//----------------------------------------------------------------------------
+TEST_F(AllocationTrackingTest, BinaryRoundTripTickRecordsBudget)
+{
+    std::vector<serialization::alloc_tick_record> ticks(10000);
+    for (size_t i = 0; i < ticks.size(); ++i)
+    {
+        ticks[i].price     = static_cast<double>(i);
+        ticks[i].timestamp = static_cast<int64_t>(i);
+    }
+
+    auto round_trip = [&]()
+    {
+        serialization::multi_process_stream stream;
+        serialization::save(stream, ticks);
+        auto buffer = std::move(stream).TakeRawData();
+
+        serialization::multi_process_stream source;
+        source.SetRawData(buffer.data(), buffer.size());
+        std::vector<serialization::alloc_tick_record> loaded;
+        serialization::load(source, loaded);
+        ASSERT_EQ(ticks.size(), loaded.size());
+    };
+    round_trip();
+
+    // The memcpy block path: a handful of arena and bookkeeping
+    // allocations regardless of element count.
+    serialization::testing::allocation_scope scope;
+    round_trip();
+    EXPECT_LE(scope.allocations(), 60u);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(AllocationTrackingTest, BinaryRoundTripPositionsBudget)
+{
+    std::vector<serialization::alloc_position> positions(1000);
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        positions[i].symbol   = "SYM" + std::to_string(i % 100);
+        positions[i].quantity = static_cast<double>(i);
+    }
+
+    auto round_trip = [&]()
+    {
+        serialization::multi_process_stream stream;
+        serialization::save(stream, positions);
+        auto buffer = std::move(stream).TakeRawData();
+
+        serialization::multi_process_stream source;
+        source.SetRawData(buffer.data(), buffer.size());
+        std::vector<serialization::alloc_position> loaded;
+        serialization::load(source, loaded);
+        ASSERT_EQ(positions.size(), loaded.size());
+    };
+    round_trip();
+
+    // String members load one string each; anything beyond roughly one
+    // allocation per element means a hot path regressed.
+    serialization::testing::allocation_scope scope;
+    round_trip();
+    EXPECT_LE(scope.allocations(), 2100u);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(AllocationTrackingTest, FacadeBinaryRoundTripBudget)
+{
+    auto tick       = std::make_shared<serialization::alloc_tick_record>();
+    tick->price     = 42.0;
+    tick->timestamp = 7;
+
+    serialization::ptr_const<serialization::alloc_tick_record> rhs = tick;
+
+    auto round_trip = [&]()
+    {
+        const auto raw = serialization::serialization_impl::access::binary_serialize(rhs);
+        auto       lhs = serialization::serialization_impl::access::binary_deserialize<
+            serialization::alloc_tick_record>(raw);
+        ASSERT_NE(nullptr, lhs);
+        EXPECT_DOUBLE_EQ(42.0, lhs->price);
+    };
+    round_trip();
+
+    // One small object through the facade: archive buffer, context
+    // arena, the loaded object and a few interning entries.
+    serialization::testing::allocation_scope scope;
+    round_trip();
+    EXPECT_LE(scope.allocations(), 40u);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(AllocationTrackingTest, ScopeCountsAreLive)
+{
+    serialization::testing::allocation_scope scope;
+    const auto                               before = scope.allocations();
+
+    // Publish the block through a volatile pointer and write through it,
+    // so an optimizing build cannot elide the unused new/delete pair and
+    // leave the counters at zero.
+    auto*                          block   = new unsigned char[512];
+    static unsigned char* volatile escaped = nullptr;
+    escaped      = block;
+    escaped[0]   = 1;
+    escaped[511] = escaped[0];
+    EXPECT_GT(scope.allocations(), before);
+    EXPECT_GE(scope.bytes(), 512u);
+    delete[] block;
+}
@@ -5,8 +5,12 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
+#include <filesystem>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <memory_resource>
 #include <optional>
 #include <set>
 #include <string>
@@ -17,9 +21,13 @@
 #include <vector>
 
 #include "common/serialization_macros.h"
+#include "util/block_compression.h"
+#include "util/byte_swap.h"
+#include "serialization.h"
 #include "serialization_impl.h"
 #include "util/multi_process_stream.h"
 #include "util/pointer.h"
+#include "util/shared_memory_ring.h"
 
 //=============================================================================
 // Test Classes
@@ -43,6 +51,120 @@ private:
 
     friend struct serialization::access::serializer;
 };
+
+// Node with a shared_ptr link, used for graph/cycle round trips.
+class test_node
+{
+public:
+    test_node() = default;
+
+    double                     value{0};
+    std::shared_ptr<test_node> next;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_node, value, next);
+
+    friend struct serialization::access::serializer;
+};
+
+// Padding-free scalar record eligible for the memcpy fast path.
+class test_tick_record
+{
+public:
+    test_tick_record() = default;
+
+    double  price{0};
+    double  volume{0};
+    int64_t timestamp{0};
+    int32_t venue{0};
+    int32_t flags{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_tick_record, price, volume, timestamp, venue, flags);
+
+    friend struct serialization::access::serializer;
+};
+// Position-style record with a string member, so container saves take
+// the element-by-element path rather than a block write.
+class test_position
+{
+public:
+    test_position() = default;
+
+    std::string symbol;
+    double      quantity{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_position, symbol, quantity);
+
+    friend struct serialization::access::serializer;
+};
+// Book of positions under one owner, used by the byte-attribution
+// profile to check container subtrees.
+class test_book
+{
+public:
+    test_book() = default;
+
+    std::string                owner;
+    std::vector<test_position> positions;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_book, owner, positions);
+
+    friend struct serialization::access::serializer;
+};
+// Fixed-size records differing only in array length; deserializing one
+// as the other trips the array size check deterministically.
+class test_grid3
+{
+public:
+    test_grid3() = default;
+
+    std::array<double, 3> values{};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_grid3, values);
+
+    friend struct serialization::access::serializer;
+};
+class test_grid4
+{
+public:
+    test_grid4() = default;
+
+    std::array<double, 4> values{};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_grid4, values);
+
+    friend struct serialization::access::serializer;
+};
+// Sparse instrument-style record: flags and mostly-absent optionals
+// that exercise the bit-packed presence mask.
+class test_sparse_quote
+{
+public:
+    test_sparse_quote() = default;
+
+    bool                       live{false};
+    bool                       indicative{false};
+    std::optional<double>      bid;
+    std::optional<double>      ask;
+    std::optional<std::string> venue;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_sparse_quote, live, indicative, bid, ask, venue);
+
+    friend struct serialization::access::serializer;
+};
 }  // namespace serialization
 
 //=============================================================================
@@ -352,6 +474,23 @@ TEST_F(BinarySerializationTest, VariantWithMonostateSerialization)
     EXPECT_TRUE(std::holds_alternative<std::monostate>(lhs));
 }
 
+TEST_F(BinarySerializationTest, VariantAlternativeSwitchAndReuse)
+{
+    // Loading emplaces over a different engaged alternative and reuses a
+    // matching one in place.
+    std::variant<int, double, std::string> rhs = 2.5;
+    std::variant<int, double, std::string> lhs = std::string("replaced");
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+    ASSERT_TRUE(std::holds_alternative<double>(lhs));
+    EXPECT_DOUBLE_EQ(2.5, std::get<double>(lhs));
+
+    rhs = 7.75;
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+    EXPECT_DOUBLE_EQ(7.75, std::get<double>(lhs));
+}
+
 //=============================================================================
 // Tuple Tests
 //=============================================================================
@@ -398,6 +537,55 @@ TEST_F(BinarySerializationTest, VectorOfPairsSerialization)
     EXPECT_EQ(rhs, lhs);
 }
 
+//=============================================================================
+// Schema-Trusted (Untagged) Mode Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, SchemaTrustedRoundTrip)
+{
+    serialization::multi_process_stream untagged;
+    untagged.SetSchemaTrusted(true);
+
+    std::vector<double> rhs = {1.1, 2.2, 3.3};
+    serialization::save(buffer, rhs);
+    serialization::save(untagged, rhs);
+
+    // Untagged archives drop the one-byte type tag per value.
+    EXPECT_LT(untagged.Size(), buffer.Size());
+
+    std::vector<double> lhs;
+    serialization::load(untagged, lhs);
+    EXPECT_EQ(rhs, lhs);
+}
+
+//=============================================================================
+// Stream Move Semantics Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, StreamMoveConstruction)
+{
+    int a_in = 42;
+    serialization::save(buffer, a_in);
+
+    serialization::multi_process_stream moved(std::move(buffer));
+    int                                 a_out = 0;
+    serialization::load(moved, a_out);
+    EXPECT_EQ(a_in, a_out);
+}
+
+TEST_F(BinarySerializationTest, StreamMoveAssignment)
+{
+    std::vector<double> rhs = {1.1, 2.2, 3.3};
+    serialization::save(buffer, rhs);
+
+    serialization::multi_process_stream moved;
+    moved = std::move(buffer);
+
+    std::vector<double> lhs;
+    serialization::load(moved, lhs);
+    EXPECT_EQ(rhs, lhs);
+}
+
 TEST_F(BinarySerializationTest, VectorOfOptionalsSerialization)
 {
     std::vector<std::optional<int>> rhs{1, std::nullopt, 3, std::nullopt, 5};
@@ -411,3 +599,1739 @@ TEST_F(BinarySerializationTest, VectorOfOptionalsSerialization)
     EXPECT_FALSE(lhs[3].has_value());
     EXPECT_TRUE(lhs[4].has_value() && *lhs[4] == 5);
 }
+
+//=============================================================================
+// Cross-Endian Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, ByteSwapKernels)
+{
+    EXPECT_EQ(0x3412U, serialization::byte_swap(static_cast<uint16_t>(0x1234U)));
+    EXPECT_EQ(0x78563412U, serialization::byte_swap(0x12345678U));
+    EXPECT_EQ(0xEFCDAB8967452301ULL, serialization::byte_swap(0x0123456789ABCDEFULL));
+
+    // Bulk kernel: swapping twice is the identity, also on the scalar tail.
+    std::vector<double> values(37);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<double>(i) * 1.5 - 10.0;
+    }
+    std::vector<double> swapped = values;
+    serialization::byte_swap_array(swapped.data(), swapped.size());
+    EXPECT_NE(values, swapped);
+    serialization::byte_swap_array(swapped.data(), swapped.size());
+    EXPECT_EQ(values, swapped);
+}
+
+TEST_F(BinarySerializationTest, CrossEndianScalarRead)
+{
+    const unsigned char foreign_endianness = (buffer.endianness() == 0U) ? 1U : 0U;
+
+    // Hand-build a foreign-endian archive: int32 tag, byte-reversed payload,
+    // trailing endianness marker.
+    const int     expected = 0x01020304;
+    unsigned char bytes[sizeof(int)];
+    std::memcpy(bytes, &expected, sizeof(int));
+    std::reverse(bytes, bytes + sizeof(int));
+
+    std::vector<unsigned char> raw;
+    raw.push_back(0U);  // serializationInternals::int32_value
+    raw.insert(raw.end(), bytes, bytes + sizeof(int));
+    raw.push_back(foreign_endianness);
+
+    buffer.SetRawData(raw.data(), raw.size());
+    int value = 0;
+    buffer >> value;
+    EXPECT_EQ(expected, value);
+}
+
+TEST_F(BinarySerializationTest, CrossEndianArrayRead)
+{
+    const unsigned char foreign_endianness = (buffer.endianness() == 0U) ? 1U : 0U;
+
+    const std::vector<double> expected = {1.5, -2.25, 1e300, 0.0, 42.0};
+
+    std::vector<unsigned char> raw;
+    raw.push_back(4U);  // serializationInternals::double_value
+
+    unsigned int  size = static_cast<unsigned int>(expected.size());
+    unsigned char size_bytes[sizeof(unsigned int)];
+    std::memcpy(size_bytes, &size, sizeof(unsigned int));
+    std::reverse(size_bytes, size_bytes + sizeof(unsigned int));
+    raw.insert(raw.end(), size_bytes, size_bytes + sizeof(unsigned int));
+
+    for (const double d : expected)
+    {
+        unsigned char element[sizeof(double)];
+        std::memcpy(element, &d, sizeof(double));
+        std::reverse(element, element + sizeof(double));
+        raw.insert(raw.end(), element, element + sizeof(double));
+    }
+    raw.push_back(foreign_endianness);
+
+    buffer.SetRawData(raw.data(), raw.size());
+
+    std::vector<double> lhs(expected.size());
+    double*             array = lhs.data();
+    buffer.Pop(array, size);
+    EXPECT_EQ(expected, lhs);
+}
+
+TEST_F(BinarySerializationTest, CrossEndianMemcpyableRead)
+{
+    static_assert(
+        serialization::impl::MemcpyableReflectable<serialization::test_tick_record>,
+        "test_tick_record must take the memcpy fast path");
+    const unsigned char foreign_endianness = (buffer.endianness() == 0U) ? 1U : 0U;
+
+    serialization::test_tick_record expected;
+    expected.price     = 101.25;
+    expected.volume    = 5000.0;
+    expected.timestamp = 1700000000123456789LL;
+    expected.venue     = 7;
+    expected.flags     = 3;
+
+    // Hand-build the foreign-endian archive a writer on the other byte
+    // order would produce: class-name record, schema fingerprint, then
+    // the memcpy block with each member byte-reversed.
+    std::vector<unsigned char> raw;
+    auto                       push_swapped = [&raw](auto value)
+    {
+        unsigned char bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        std::reverse(bytes, bytes + sizeof(value));
+        raw.insert(raw.end(), bytes, bytes + sizeof(value));
+    };
+    auto push_members = [&push_swapped](const serialization::test_tick_record& record)
+    {
+        push_swapped(record.price);
+        push_swapped(record.volume);
+        push_swapped(record.timestamp);
+        push_swapped(record.venue);
+        push_swapped(record.flags);
+    };
+
+    const std::string name = "serialization::test_tick_record";
+    raw.push_back(1U);  // serializationInternals::uint32_value (intern id)
+    push_swapped(0U);
+    raw.push_back(6U);  // serializationInternals::string_value
+    push_swapped(static_cast<unsigned int>(name.size()));
+    raw.insert(raw.end(), name.begin(), name.end());
+    raw.push_back(7U);  // serializationInternals::int64_value (fingerprint)
+    push_swapped(static_cast<int64_t>(
+        serialization::impl::schema_fingerprint<serialization::test_tick_record>()));
+    raw.push_back(3U);  // serializationInternals::uchar_value (memcpy block)
+    push_swapped(static_cast<unsigned int>(sizeof(expected)));
+    push_members(expected);
+    raw.push_back(foreign_endianness);
+
+    buffer.SetRawData(raw.data(), raw.size());
+    serialization::test_tick_record loaded;
+    serialization::load(buffer, loaded);
+    EXPECT_DOUBLE_EQ(expected.price, loaded.price);
+    EXPECT_DOUBLE_EQ(expected.volume, loaded.volume);
+    EXPECT_EQ(expected.timestamp, loaded.timestamp);
+    EXPECT_EQ(expected.venue, loaded.venue);
+    EXPECT_EQ(expected.flags, loaded.flags);
+
+    // Same through the pod-container block path: count, then one block
+    // holding both elements.
+    serialization::test_tick_record second = expected;
+    second.price                           = -0.5;
+    second.flags                           = 9;
+
+    raw.clear();
+    raw.push_back(1U);  // element count
+    push_swapped(2U);
+    raw.push_back(3U);  // block of element bytes
+    push_swapped(static_cast<unsigned int>(2 * sizeof(expected)));
+    push_members(expected);
+    push_members(second);
+    raw.push_back(foreign_endianness);
+
+    serialization::multi_process_stream               container_stream;
+    std::vector<serialization::test_tick_record>     list;
+    container_stream.SetRawData(raw.data(), raw.size());
+    serialization::load(container_stream, list);
+    ASSERT_EQ(2U, list.size());
+    EXPECT_DOUBLE_EQ(expected.price, list[0].price);
+    EXPECT_EQ(expected.timestamp, list[0].timestamp);
+    EXPECT_DOUBLE_EQ(-0.5, list[1].price);
+    EXPECT_EQ(9, list[1].flags);
+}
+
+TEST_F(BinarySerializationTest, CopyOfBorrowingStreamOwnsItsBytes)
+{
+    buffer << 2.5;
+    buffer << 7;
+    buffer << std::string("borrowed");
+    std::vector<unsigned char> raw = buffer.GetRawData();
+
+    // Borrow the caller's buffer, copy the stream, then destroy the
+    // buffer: the copy must have folded the view into its own arena.
+    serialization::multi_process_stream copied;
+    {
+        serialization::multi_process_stream borrowing;
+        borrowing.SetRawData(raw.data(), raw.size());
+        copied = borrowing;
+    }
+    std::fill(raw.begin(), raw.end(), static_cast<unsigned char>(0xFF));
+    raw.clear();
+    raw.shrink_to_fit();
+
+    double      d = 0;
+    int         i = 0;
+    std::string s;
+    copied >> d;
+    copied >> i;
+    copied >> s;
+    EXPECT_DOUBLE_EQ(2.5, d);
+    EXPECT_EQ(7, i);
+    EXPECT_EQ("borrowed", s);
+
+    // Same for an adopted chunk list with a partially consumed head.
+    buffer.Reset();
+    buffer << 11;
+    buffer << 13;
+    std::vector<unsigned char> whole = std::move(buffer).TakeRawData();
+    const size_t               split = whole.size() / 2;
+    std::vector<std::vector<unsigned char>> chunks;
+    chunks.emplace_back(whole.begin(), whole.begin() + static_cast<std::ptrdiff_t>(split));
+    chunks.emplace_back(whole.begin() + static_cast<std::ptrdiff_t>(split), whole.end());
+
+    serialization::multi_process_stream chunked;
+    chunked.SetRawChunks(std::move(chunks));
+    int first = 0;
+    chunked >> first;
+    EXPECT_EQ(11, first);
+
+    serialization::multi_process_stream chunked_copy(chunked);
+    int second = 0;
+    chunked_copy >> second;
+    EXPECT_EQ(13, second);
+    chunked >> second;
+    EXPECT_EQ(13, second);
+}
+
+TEST_F(BinarySerializationTest, GetRawDataRoundTripKeepsEndianness)
+{
+    buffer << 1.5;
+    buffer << 42;
+    buffer << std::string("endian");
+
+    const std::vector<unsigned char> raw = buffer.GetRawData();
+    ASSERT_FALSE(raw.empty());
+    // The endianness marker must be the very last byte — SetRawData reads
+    // it from data.back(), and a stray trailing byte would make the
+    // reader byte-swap everything.
+    EXPECT_EQ(buffer.endianness(), raw.back());
+    EXPECT_EQ(std::move(buffer).TakeRawData(), raw);
+
+    serialization::multi_process_stream restored;
+    restored.SetRawData(raw);
+
+    double      d = 0;
+    int         i = 0;
+    std::string s;
+    restored >> d;
+    restored >> i;
+    restored >> s;
+    EXPECT_DOUBLE_EQ(1.5, d);
+    EXPECT_EQ(42, i);
+    EXPECT_EQ("endian", s);
+}
+
+//=============================================================================
+// Varint Encoding Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, VarintRoundTrip)
+{
+    serialization::multi_process_stream varint;
+    varint.SetVarintEncoding(true);
+
+    int                      a_in = 42;
+    int64_t                  b_in = -7;
+    size_t                   c_in = 130;
+    std::vector<std::string> d_in = {"abc", "", "de"};
+
+    serialization::save(buffer, a_in);
+    serialization::save(buffer, b_in);
+    serialization::save(buffer, c_in);
+    serialization::save(buffer, d_in);
+
+    serialization::save(varint, a_in);
+    serialization::save(varint, b_in);
+    serialization::save(varint, c_in);
+    serialization::save(varint, d_in);
+
+    // Small integers and size prefixes collapse to one or two bytes.
+    EXPECT_LT(varint.Size(), buffer.Size());
+
+    int                      a_out = 0;
+    int64_t                  b_out = 0;
+    size_t                   c_out = 0;
+    std::vector<std::string> d_out;
+    serialization::load(varint, a_out);
+    serialization::load(varint, b_out);
+    serialization::load(varint, c_out);
+    serialization::load(varint, d_out);
+    EXPECT_EQ(a_in, a_out);
+    EXPECT_EQ(b_in, b_out);
+    EXPECT_EQ(c_in, c_out);
+    EXPECT_EQ(d_in, d_out);
+}
+
+TEST_F(BinarySerializationTest, VarintExtremeValues)
+{
+    serialization::multi_process_stream varint;
+    varint.SetVarintEncoding(true);
+
+    std::map<std::string, int64_t> rhs = {
+        {"min", std::numeric_limits<int64_t>::min()},
+        {"max", std::numeric_limits<int64_t>::max()},
+        {"minus_one", -1},
+        {"zero", 0}};
+    serialization::save(varint, rhs);
+
+    std::map<std::string, int64_t> lhs;
+    serialization::load(varint, lhs);
+    EXPECT_EQ(rhs, lhs);
+}
+
+//=============================================================================
+// Streaming Sink Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, StreamingSinkBoundedChunks)
+{
+    std::vector<unsigned char> collected;
+    size_t                     chunk_count = 0;
+
+    serialization::multi_process_stream streaming;
+    streaming.SetSink(
+        [&](const unsigned char* data, size_t size)
+        {
+            collected.insert(collected.end(), data, data + size);
+            ++chunk_count;
+        },
+        16 /* chunk_size */);
+
+    std::vector<double> rhs(64, 3.25);
+    std::string         label = "streamed";
+    serialization::save(streaming, rhs);
+    serialization::save(streaming, label);
+    streaming.Flush();
+    collected.push_back(streaming.endianness());
+
+    // The archive is much larger than the chunk size, so it must have been
+    // handed over in several pieces.
+    EXPECT_GT(chunk_count, 1U);
+
+    serialization::multi_process_stream reader;
+    reader.SetRawData(collected);
+    std::vector<double> lhs;
+    std::string         label_out;
+    serialization::load(reader, lhs);
+    serialization::load(reader, label_out);
+    EXPECT_EQ(rhs, lhs);
+    EXPECT_EQ(label, label_out);
+}
+
+TEST_F(BinarySerializationTest, WriteToBinaryStreamsToFile)
+{
+    const std::string path = "test_binary_streaming_output.bin";
+
+    serialization::ptr_const<serialization::test_serialization> rhs =
+        std::make_shared<serialization::test_serialization>(2.5);
+    serialization::serialization_impl::access::write_to_binary(path, rhs);
+
+    auto lhs =
+        serialization::serialization_impl::access::read_from_binary<serialization::test_serialization>(
+            path);
+    ASSERT_NE(nullptr, lhs);
+    EXPECT_DOUBLE_EQ(rhs->d(), lhs->d());
+}
+
+//=============================================================================
+// Class-Name Interning Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, ClassNameInterning)
+{
+    std::vector<serialization::ptr_const<serialization::test_serialization>> rhs;
+    for (int i = 0; i < 8; ++i)
+    {
+        rhs.push_back(std::make_shared<serialization::test_serialization>(i * 1.5));
+    }
+    serialization::save(buffer, rhs);
+
+    // The demangled class name must appear once in the archive; every
+    // further occurrence is an interned id.
+    const auto        view = buffer.GetRawDataView();
+    const std::string raw(reinterpret_cast<const char*>(view.data()), view.size());
+    size_t            occurrences = 0;
+    for (size_t pos = raw.find("test_serialization"); pos != std::string::npos;
+         pos        = raw.find("test_serialization", pos + 1))
+    {
+        ++occurrences;
+    }
+    EXPECT_EQ(1U, occurrences);
+
+    std::vector<serialization::ptr_const<serialization::test_serialization>> lhs;
+    serialization::load(buffer, lhs);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        ASSERT_NE(nullptr, lhs[i]);
+        EXPECT_DOUBLE_EQ(rhs[i]->d(), lhs[i]->d());
+    }
+}
+
+//=============================================================================
+// Pointer-Identity Tracking Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, SharedPtrIdentityDeduplication)
+{
+    auto shared = std::make_shared<serialization::test_serialization>(7.5);
+
+    std::vector<serialization::ptr_const<serialization::test_serialization>> rhs(
+        10, shared);
+    rhs[1] = std::make_shared<serialization::test_serialization>(1.0);
+
+    serialization::multi_process_stream plain;
+    serialization::save(plain, rhs);
+
+    std::vector<serialization::ptr_const<serialization::test_serialization>> lhs;
+    {
+        serialization::identity_tracking_scope scope;
+        serialization::save(buffer, rhs);
+
+        // The repeated target is written once plus a reference record.
+        EXPECT_LT(buffer.Size(), plain.Size());
+
+        serialization::load(buffer, lhs);
+    }
+
+    ASSERT_EQ(rhs.size(), lhs.size());
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        ASSERT_NE(nullptr, lhs[i]);
+        EXPECT_DOUBLE_EQ(rhs[i]->d(), lhs[i]->d());
+    }
+
+    // Sharing semantics survive the round trip: every duplicate resolves
+    // to the same object.
+    EXPECT_EQ(lhs[0].get(), lhs[2].get());
+    EXPECT_EQ(lhs[0].get(), lhs[9].get());
+    EXPECT_NE(lhs[0].get(), lhs[1].get());
+}
+
+//=============================================================================
+// Cyclic Graph Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, CyclicGraphRoundTrip)
+{
+    auto a   = std::make_shared<serialization::test_node>();
+    auto b   = std::make_shared<serialization::test_node>();
+    a->value = 1.0;
+    b->value = 2.0;
+    a->next  = b;
+    b->next  = a;
+
+    serialization::identity_tracking_scope scope;
+
+    std::shared_ptr<serialization::test_node> rhs = a;
+    serialization::save(buffer, rhs);
+
+    std::shared_ptr<serialization::test_node> lhs;
+    serialization::load(buffer, lhs);
+
+    ASSERT_NE(nullptr, lhs);
+    ASSERT_NE(nullptr, lhs->next);
+    EXPECT_DOUBLE_EQ(1.0, lhs->value);
+    EXPECT_DOUBLE_EQ(2.0, lhs->next->value);
+
+    // The back-reference closes the cycle on the restored graph.
+    EXPECT_EQ(lhs, lhs->next->next);
+}
+
+TEST_F(BinarySerializationTest, DepthGuardStopsUntrackedCycle)
+{
+    auto a  = std::make_shared<serialization::test_node>();
+    auto b  = std::make_shared<serialization::test_node>();
+    a->next = b;
+    b->next = a;
+
+    // Without identity tracking, the depth guard converts the endless
+    // recursion into an error instead of a stack overflow.
+    serialization::detail::serialization_context context;
+    std::shared_ptr<serialization::test_node>    rhs = a;
+    EXPECT_THROW(serialization::save(buffer, rhs, context), std::runtime_error);
+}
+
+//=============================================================================
+// Field Index Tests
+//=============================================================================
+
+TEST_F(BinarySerializationTest, FieldIndexPointRead)
+{
+    auto node         = std::make_shared<serialization::test_node>();
+    node->value       = 5.5;
+    node->next        = std::make_shared<serialization::test_node>();
+    node->next->value = 7.25;
+
+    serialization::ptr_const<serialization::test_node> rhs = node;
+    const std::vector<unsigned char>                   raw =
+        serialization::serialization_impl::access::binary_serialize_indexed(rhs);
+
+    // Single fields decode straight from their recorded byte ranges.
+    EXPECT_DOUBLE_EQ(
+        5.5, serialization::serialization_impl::access::read_binary_field<double>(raw, "value"));
+    EXPECT_DOUBLE_EQ(
+        7.25,
+        serialization::serialization_impl::access::read_binary_field<double>(raw, "next.value"));
+
+    size_t offset = 0;
+    size_t length = 0;
+    EXPECT_FALSE(serialization::serialization_impl::access::find_indexed_field(
+        raw, "no_such_field", offset, length));
+
+    // The footer does not disturb full deserialization.
+    auto lhs =
+        serialization::serialization_impl::access::binary_deserialize<serialization::test_node>(
+            raw);
+    ASSERT_NE(nullptr, lhs);
+    EXPECT_DOUBLE_EQ(5.5, lhs->value);
+    ASSERT_NE(nullptr, lhs->next);
+    EXPECT_DOUBLE_EQ(7.25, lhs->next->value);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, BinarySizeProfileAttribution)
+{
+    auto book   = std::make_shared<serialization::test_book>();
+    book->owner = "desk-7";
+    book->positions.resize(32);
+    for (size_t i = 0; i < book->positions.size(); ++i)
+    {
+        book->positions[i].symbol   = "SYM" + std::to_string(i);
+        book->positions[i].quantity = static_cast<double>(i);
+    }
+
+    serialization::ptr_const<serialization::test_book> rhs = book;
+    const serialization::json                          report =
+        serialization::serialization_impl::access::binary_size_profile(rhs);
+
+    const auto total = report["total_bytes"].get<uint64_t>();
+    EXPECT_GT(total, 0u);
+
+    const auto& fields = report["fields"];
+    ASSERT_TRUE(fields.contains("owner"));
+    ASSERT_TRUE(fields.contains("positions"));
+
+    // The container dominates the archive and its subtree breaks down
+    // into the element members, written once per element.
+    const auto& positions = fields["positions"];
+    EXPECT_GT(
+        positions["bytes"].get<uint64_t>(), fields["owner"]["bytes"].get<uint64_t>());
+    ASSERT_TRUE(positions.contains("fields"));
+    const auto& element_fields = positions["fields"];
+    ASSERT_TRUE(element_fields.contains("symbol"));
+    ASSERT_TRUE(element_fields.contains("quantity"));
+    EXPECT_EQ(32u, element_fields["symbol"]["count"].get<uint64_t>());
+    EXPECT_EQ(32u, element_fields["quantity"]["count"].get<uint64_t>());
+    // Each double costs its payload plus the stream's type tag.
+    EXPECT_GE(element_fields["quantity"]["bytes"].get<uint64_t>(), 32u * sizeof(double));
+
+    // Parent bytes include the children; shares are fractions of the
+    // whole archive and the bracketed top-level fields plus the framing
+    // overhead account for every byte.
+    EXPECT_GE(
+        positions["bytes"].get<uint64_t>(),
+        element_fields["symbol"]["bytes"].get<uint64_t>() +
+            element_fields["quantity"]["bytes"].get<uint64_t>());
+    EXPECT_NEAR(
+        positions["share"].get<double>(),
+        static_cast<double>(positions["bytes"].get<uint64_t>()) / static_cast<double>(total),
+        1e-12);
+    EXPECT_EQ(
+        total,
+        fields["owner"]["bytes"].get<uint64_t>() + positions["bytes"].get<uint64_t>() +
+            report["unattributed_bytes"].get<uint64_t>());
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, SectionedParallelRoundTrip)
+{
+    std::vector<serialization::ptr_const<serialization::test_node>> rhs;
+    for (size_t i = 0; i < 64; ++i)
+    {
+        auto node   = std::make_shared<serialization::test_node>();
+        node->value = static_cast<double>(i) * 0.5;
+        rhs.push_back(node);
+    }
+
+    const std::vector<unsigned char> raw =
+        serialization::serialization_impl::access::binary_serialize_sections(rhs);
+
+    // Sections decode concurrently and land in their original order.
+    auto lhs = serialization::serialization_impl::access::binary_deserialize_sections<
+        serialization::test_node>(raw, 4);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        ASSERT_NE(nullptr, lhs[i]);
+        EXPECT_DOUBLE_EQ(static_cast<double>(i) * 0.5, lhs[i]->value);
+    }
+
+    // A single worker takes the sequential path and agrees with the pool.
+    auto serial = serialization::serialization_impl::access::binary_deserialize_sections<
+        serialization::test_node>(raw, 1);
+    ASSERT_EQ(rhs.size(), serial.size());
+    EXPECT_DOUBLE_EQ(serial.back()->value, lhs.back()->value);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, BatchSerializeMatchesSingleObjectPath)
+{
+    std::vector<serialization::ptr_const<serialization::test_node>> rhs;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        auto node   = std::make_shared<serialization::test_node>();
+        node->value = static_cast<double>(i) + 0.125;
+        rhs.push_back(node);
+    }
+
+    const auto buffers =
+        serialization::serialization_impl::access::binary_serialize_batch(rhs, 4);
+    ASSERT_EQ(rhs.size(), buffers.size());
+
+    // Every batch buffer is byte-identical to a standalone serialization
+    // and deserializes through the ordinary single-object entry point.
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        EXPECT_EQ(
+            serialization::serialization_impl::access::binary_serialize(rhs[i]), buffers[i]);
+    }
+    auto lhs =
+        serialization::serialization_impl::access::binary_deserialize<serialization::test_node>(
+            buffers[42]);
+    ASSERT_NE(nullptr, lhs);
+    EXPECT_DOUBLE_EQ(42.125, lhs->value);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, LoadArenaRecyclesStorage)
+{
+    serialization::detail::load_arena arena;
+
+    void* first = arena.allocate(32);
+    ASSERT_NE(nullptr, first);
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(first) % alignof(std::max_align_t));
+    EXPECT_NE(first, arena.allocate(32));
+
+    std::string& scratch = arena.scratch_string();
+    scratch              = "serialization::test_node";
+    const char* capacity = scratch.data();
+
+    // release() hands everything back at once; the next cycle reuses the
+    // same block and the same string capacity instead of reallocating.
+    arena.release();
+    EXPECT_EQ(first, arena.allocate(32));
+    std::string& recycled = arena.scratch_string();
+    EXPECT_TRUE(recycled.empty());
+    EXPECT_EQ(capacity, recycled.data());
+
+    // Requests larger than a block get dedicated storage.
+    EXPECT_NE(nullptr, arena.allocate(256 * 1024));
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, StringViewPopBorrowsFromRawBuffer)
+{
+    buffer << std::string_view("alpha payload") << 17 << std::string_view("omega");
+    const std::vector<unsigned char> raw = std::move(buffer).TakeRawData();
+
+    // Views returned while borrowing point into the caller's buffer; no
+    // string bytes are copied out of the stream.
+    serialization::multi_process_stream reader;
+    reader.SetRawData(raw.data(), raw.size());
+
+    std::string_view first;
+    int              middle = 0;
+    std::string_view last;
+    reader >> first >> middle >> last;
+
+    EXPECT_EQ("alpha payload", first);
+    EXPECT_EQ(17, middle);
+    EXPECT_EQ("omega", last);
+
+    const auto* begin = reinterpret_cast<const char*>(raw.data());
+    const auto* end   = begin + raw.size();
+    EXPECT_TRUE(first.data() >= begin && first.data() + first.size() <= end);
+    EXPECT_TRUE(last.data() >= begin && last.data() + last.size() <= end);
+
+    // Callers that outlive the buffer copy on demand.
+    const std::string owned(first);
+    EXPECT_EQ("alpha payload", owned);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, BlockCompressionRoundTrip)
+{
+    // Repetitive payloads shrink; incompressible ones fall back to raw.
+    std::vector<unsigned char> repetitive;
+    for (size_t i = 0; i < 4096; ++i)
+    {
+        repetitive.push_back(static_cast<unsigned char>(i % 16));
+    }
+
+    std::vector<unsigned char> framed;
+    serialization::append_compressed_block(
+        framed, repetitive.data(), repetitive.size(), serialization::compression_codec::lz);
+    EXPECT_LT(framed.size(), repetitive.size());
+
+    std::vector<unsigned char> random;
+    unsigned int               seed = 12345;
+    for (size_t i = 0; i < 512; ++i)
+    {
+        seed = seed * 1103515245 + 12345;
+        random.push_back(static_cast<unsigned char>(seed >> 16));
+    }
+    serialization::append_compressed_block(
+        framed, random.data(), random.size(), serialization::compression_codec::lz);
+
+    std::vector<unsigned char> restored;
+    ASSERT_TRUE(
+        serialization::decompress_blocks(framed.data(), framed.size(), restored, 2));
+    ASSERT_EQ(repetitive.size() + random.size(), restored.size());
+    EXPECT_EQ(0, std::memcmp(restored.data(), repetitive.data(), repetitive.size()));
+    EXPECT_EQ(0, std::memcmp(restored.data() + repetitive.size(), random.data(), random.size()));
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, CompressedFileRoundTrip)
+{
+    std::vector<serialization::ptr_const<serialization::test_node>> nodes;
+    auto root = std::make_shared<serialization::test_node>();
+    auto tail = root;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        tail->value = 1.0;
+        tail->next  = std::make_shared<serialization::test_node>();
+        tail        = tail->next;
+    }
+
+    serialization::ptr_const<serialization::test_node> rhs = root;
+    const std::string file = "test_binary_compressed_output.bin";
+    serialization::serialization_impl::access::write_to_binary(
+        file, rhs, serialization::compression_codec::lz);
+
+    auto lhs = serialization::serialization_impl::access::read_from_binary<
+        serialization::test_node>(file, 2);
+    ASSERT_NE(nullptr, lhs);
+    EXPECT_DOUBLE_EQ(1.0, lhs->value);
+    ASSERT_NE(nullptr, lhs->next);
+
+    // Repeated class names and doubles compress well below the raw size.
+    const auto raw = serialization::serialization_impl::access::binary_serialize(rhs);
+    EXPECT_LT(std::filesystem::file_size(file), raw.size());
+    std::filesystem::remove(file);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, AsyncWriteFlushFence)
+{
+    auto node   = std::make_shared<serialization::test_node>();
+    node->value = 3.75;
+
+    serialization::ptr_const<serialization::test_node> rhs = node;
+    std::vector<unsigned char> raw = serialization::serialization_impl::access::binary_serialize(rhs);
+    const std::vector<unsigned char> expected = raw;
+
+    const std::string file = "test_binary_async_output.bin";
+    serialization::serialization_impl::access::write_binary_async(file, std::move(raw));
+
+    // The fence guarantees the buffer reached the file; afterwards the
+    // archive reads back through the ordinary synchronous path.
+    serialization::serialization_impl::access::flush_binary_writes();
+    std::vector<unsigned char> readback;
+    serialization::serialization_impl::access::read_binary(file, readback);
+    EXPECT_EQ(expected, readback);
+
+    auto lhs =
+        serialization::serialization_impl::access::binary_deserialize<serialization::test_node>(
+            readback);
+    ASSERT_NE(nullptr, lhs);
+    EXPECT_DOUBLE_EQ(3.75, lhs->value);
+    std::filesystem::remove(file);
+}
+
+TEST_F(BinarySerializationTest, MemcpyFastPathRoundTrip)
+{
+    static_assert(serialization::impl::MemcpyableReflectable<serialization::test_tick_record>);
+    // A shared_ptr member keeps test_node on the reflection walk.
+    static_assert(!serialization::impl::MemcpyableReflectable<serialization::test_node>);
+
+    serialization::test_tick_record rhs;
+    rhs.price     = 101.25;
+    rhs.volume    = 1500.0;
+    rhs.timestamp = 1693382400123456789LL;
+    rhs.venue     = 7;
+    rhs.flags     = 0x11;
+
+    serialization::test_tick_record lhs;
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+    EXPECT_EQ(rhs.price, lhs.price);
+    EXPECT_EQ(rhs.volume, lhs.volume);
+    EXPECT_EQ(rhs.timestamp, lhs.timestamp);
+    EXPECT_EQ(rhs.venue, lhs.venue);
+    EXPECT_EQ(rhs.flags, lhs.flags);
+}
+
+TEST_F(BinarySerializationTest, PodContainerBlockRoundTrip)
+{
+    std::vector<serialization::test_tick_record> rhs(1000);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].price     = static_cast<double>(i) * 0.01;
+        rhs[i].volume    = static_cast<double>(i % 97);
+        rhs[i].timestamp = static_cast<int64_t>(i) * 1000;
+        rhs[i].venue     = static_cast<int32_t>(i % 5);
+        rhs[i].flags     = static_cast<int32_t>(i & 0xFF);
+    }
+
+    std::vector<serialization::test_tick_record> lhs;
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+
+    ASSERT_EQ(rhs.size(), lhs.size());
+    EXPECT_EQ(0, std::memcmp(rhs.data(), lhs.data(), rhs.size() * sizeof(rhs[0])));
+
+    // One block write: the payload is the raw bytes plus a few bytes of
+    // framing, nowhere near a per-member encoding.
+    buffer.Reset();
+    serialization::save(buffer, rhs);
+    EXPECT_LT(buffer.GetRawDataView().size(), rhs.size() * sizeof(rhs[0]) + 64);
+}
+
+TEST_F(BinarySerializationTest, ParallelContainerSaveMatchesSequential)
+{
+    std::vector<serialization::test_position> rhs(4096);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].symbol   = "sym" + std::to_string(i % 100);
+        rhs[i].quantity = static_cast<double>(i) * 0.5;
+    }
+
+    serialization::save(buffer, rhs);
+
+    // The parallel save splices per-chunk worker segments back in element
+    // order, so the bytes are identical to the sequential archive.
+    serialization::multi_process_stream parallel;
+    {
+        serialization::parallel_save_scope scope(4);
+        serialization::save(parallel, rhs);
+    }
+    const auto sequential_view = buffer.GetRawDataView();
+    const auto parallel_view   = parallel.GetRawDataView();
+    ASSERT_EQ(sequential_view.size(), parallel_view.size());
+    EXPECT_EQ(
+        0, std::memcmp(sequential_view.data(), parallel_view.data(), sequential_view.size()));
+
+    std::vector<serialization::test_position> lhs;
+    serialization::load(parallel, lhs);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    EXPECT_EQ(rhs[4095].symbol, lhs[4095].symbol);
+    EXPECT_DOUBLE_EQ(rhs[4095].quantity, lhs[4095].quantity);
+}
+
+TEST_F(BinarySerializationTest, ParallelAssociativeSaveRoundTrip)
+{
+    std::map<int, double> rhs;
+    for (int i = 0; i < 2048; ++i)
+    {
+        rhs[i] = static_cast<double>(i) * 1.5;
+    }
+
+    {
+        serialization::parallel_save_scope scope;
+        serialization::save(buffer, rhs);
+    }
+
+    std::map<int, double> lhs;
+    serialization::load(buffer, lhs);
+    EXPECT_EQ(rhs, lhs);
+}
+
+TEST_F(BinarySerializationTest, IncrementalSaveSlicesConcatenate)
+{
+    std::vector<serialization::test_position> rhs(3000);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].symbol   = "inc" + std::to_string(i % 64);
+        rhs[i].quantity = static_cast<double>(i);
+    }
+
+    serialization::save(buffer, rhs);
+    const std::vector<unsigned char> sequential = std::move(buffer).TakeRawData();
+
+    // Drain the coroutine slice by slice; a small byte budget forces many
+    // suspensions, and the concatenation equals the one-shot archive.
+    serialization::incremental_budget budget;
+    budget.bytes      = 4096;
+    budget.time_slice = std::chrono::seconds(10);
+
+    auto                       task = serialization::co_serialize(rhs, budget);
+    std::vector<unsigned char> collected;
+    size_t                     slices = 0;
+    while (task.next())
+    {
+        const auto slice = task.slice();
+        collected.insert(collected.end(), slice.begin(), slice.end());
+        ++slices;
+    }
+    EXPECT_GT(slices, 4U);
+    EXPECT_EQ(sequential, collected);
+
+    serialization::multi_process_stream reader;
+    reader.SetRawData(collected);
+    std::vector<serialization::test_position> lhs;
+    serialization::load(reader, lhs);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    EXPECT_EQ(rhs[2999].symbol, lhs[2999].symbol);
+    EXPECT_DOUBLE_EQ(rhs[2999].quantity, lhs[2999].quantity);
+}
+
+TEST_F(BinarySerializationTest, SharedMemoryRingArchiveHandoff)
+{
+    auto producer = serialization::shared_memory_ring::create("/serialization_ring_test", 1 << 16);
+    if (!producer.valid())
+    {
+        GTEST_SKIP() << "shared memory is unavailable in this environment";
+    }
+    auto consumer = serialization::shared_memory_ring::open("/serialization_ring_test");
+    ASSERT_TRUE(consumer.valid());
+
+    // Hand two archives through the ring; records arrive in order and
+    // load through the borrowing SetRawData without further copies.
+    serialization::test_position rhs;
+    rhs.symbol   = "ring";
+    rhs.quantity = 42.5;
+    serialization::save(buffer, rhs);
+    ASSERT_TRUE(producer.write_archive(buffer));
+
+    serialization::multi_process_stream second;
+    serialization::save(second, std::string("follow-up"));
+    ASSERT_TRUE(producer.write_archive(second));
+
+    serialization::multi_process_stream reader;
+    ASSERT_TRUE(consumer.read_archive(reader));
+    serialization::test_position lhs;
+    serialization::load(reader, lhs);
+    EXPECT_EQ(rhs.symbol, lhs.symbol);
+    EXPECT_DOUBLE_EQ(rhs.quantity, lhs.quantity);
+
+    ASSERT_TRUE(consumer.read_archive(reader));
+    std::string label;
+    serialization::load(reader, label);
+    EXPECT_EQ("follow-up", label);
+
+    // Ring drained: the next read reports empty instead of blocking.
+    EXPECT_FALSE(consumer.read_archive(reader));
+}
+
+TEST_F(BinarySerializationTest, ValueReturningLoad)
+{
+    serialization::test_position rhs;
+    rhs.symbol   = "byvalue";
+    rhs.quantity = 5.5;
+    serialization::save(buffer, rhs);
+    const auto lhs = serialization::load<serialization::test_position>(buffer);
+    EXPECT_EQ(rhs.symbol, lhs.symbol);
+    EXPECT_DOUBLE_EQ(rhs.quantity, lhs.quantity);
+
+    std::vector<int> values{1, 2, 3};
+    serialization::save(buffer, values);
+    EXPECT_EQ(values, serialization::load<std::vector<int>>(buffer));
+
+    // A private default constructor is reached through the reflection
+    // access hooks, so hidden-constructor types return by value too.
+    serialization::test_serialization source(3.25);
+    serialization::save(buffer, source);
+    const auto loaded = serialization::load<serialization::test_serialization>(buffer);
+    EXPECT_DOUBLE_EQ(3.25, loaded.d());
+}
+
+TEST_F(BinarySerializationTest, PackedPresenceFlagsRoundTrip)
+{
+    serialization::test_sparse_quote rhs;
+    rhs.live = true;
+    rhs.bid  = 101.25;
+
+    serialization::save(buffer, rhs);
+    const int packed_size = buffer.Size();
+
+    serialization::test_sparse_quote lhs;
+    lhs.indicative = true;  // must be cleared by the load
+    lhs.ask        = 1.0;   // must be reset by the load
+    serialization::load(buffer, lhs);
+    EXPECT_TRUE(lhs.live);
+    EXPECT_FALSE(lhs.indicative);
+    ASSERT_TRUE(lhs.bid.has_value());
+    EXPECT_DOUBLE_EQ(101.25, *lhs.bid);
+    EXPECT_FALSE(lhs.ask.has_value());
+    EXPECT_FALSE(lhs.venue.has_value());
+
+    // Field-index recording keeps the flat per-member layout, which the
+    // packed bitmask undercuts by two bytes per absent flag.
+    serialization::multi_process_stream flat;
+    flat.SetFieldIndexEnabled(true);
+    serialization::save(flat, rhs);
+    EXPECT_LT(packed_size, flat.Size());
+}
+
+TEST_F(BinarySerializationTest, PackedPresenceFlagsAllStates)
+{
+    // Every flag set and every optional engaged, including a string.
+    serialization::test_sparse_quote rhs;
+    rhs.live       = true;
+    rhs.indicative = true;
+    rhs.bid        = 99.5;
+    rhs.ask        = 100.5;
+    rhs.venue      = "XEUR";
+
+    serialization::save(buffer, rhs);
+    serialization::test_sparse_quote lhs;
+    serialization::load(buffer, lhs);
+    EXPECT_TRUE(lhs.live);
+    EXPECT_TRUE(lhs.indicative);
+    EXPECT_DOUBLE_EQ(99.5, *lhs.bid);
+    EXPECT_DOUBLE_EQ(100.5, *lhs.ask);
+    EXPECT_EQ("XEUR", *lhs.venue);
+
+    // Containers of sparse records pack per element.
+    std::vector<serialization::test_sparse_quote> quotes(100);
+    quotes[7].live = true;
+    quotes[42].bid = 1.5;
+    serialization::save(buffer, quotes);
+    std::vector<serialization::test_sparse_quote> loaded;
+    serialization::load(buffer, loaded);
+    ASSERT_EQ(quotes.size(), loaded.size());
+    EXPECT_TRUE(loaded[7].live);
+    EXPECT_DOUBLE_EQ(1.5, *loaded[42].bid);
+    EXPECT_FALSE(loaded[41].bid.has_value());
+}
+
+TEST_F(BinarySerializationTest, RawChunkGatherScatterRoundTrip)
+{
+    std::vector<serialization::test_position> rhs(64);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].symbol   = "chunk" + std::to_string(i);
+        rhs[i].quantity = static_cast<double>(i) * 0.25;
+    }
+    serialization::save(buffer, rhs);
+
+    // Gathering the chunk list writev-style reproduces the raw data
+    // without the stream coalescing anything itself.
+    std::vector<unsigned char> gathered;
+    for (const auto& chunk : buffer.GetRawChunks())
+    {
+        gathered.insert(gathered.end(), chunk.begin(), chunk.end());
+    }
+    EXPECT_EQ(std::move(buffer).TakeRawData(), gathered);
+
+    // Scatter the same bytes across deliberately awkward chunk sizes so
+    // values straddle the boundaries, and load from the adopted list.
+    std::vector<std::vector<unsigned char>> scattered;
+    for (size_t pos = 0; pos < gathered.size();)
+    {
+        const size_t step = std::min<size_t>(7 + 13 * scattered.size(), gathered.size() - pos);
+        scattered.emplace_back(gathered.begin() + pos, gathered.begin() + pos + step);
+        pos += step;
+    }
+    ASSERT_GT(scattered.size(), 2U);
+
+    serialization::multi_process_stream reader;
+    reader.SetRawChunks(std::move(scattered));
+    std::vector<serialization::test_position> lhs;
+    serialization::load(reader, lhs);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    EXPECT_EQ(rhs[63].symbol, lhs[63].symbol);
+    EXPECT_DOUBLE_EQ(rhs[63].quantity, lhs[63].quantity);
+}
+
+TEST_F(BinarySerializationTest, SchemaFingerprintMismatchThrows)
+{
+    static_assert(
+        serialization::impl::schema_fingerprint<serialization::test_serialization>() !=
+        serialization::impl::schema_fingerprint<serialization::test_node>());
+
+    serialization::test_serialization rhs(11.5);
+    serialization::save(buffer, rhs);
+
+    std::vector<unsigned char> raw = std::move(buffer).TakeRawData();
+
+    // The fingerprint is the eight bytes following the first class-name
+    // record: tag + id word, tag + length word + name characters, tag.
+    const std::string name =
+        serialization::demangle(typeid(serialization::test_serialization).name());
+    const size_t fingerprint_pos =
+        1 + sizeof(unsigned int) + 1 + sizeof(unsigned int) + name.size() + 1;
+    ASSERT_LT(fingerprint_pos + 8, raw.size());
+    raw[fingerprint_pos] ^= 0xFF;
+
+    serialization::multi_process_stream tampered;
+    tampered.SetRawData(raw);
+    serialization::test_serialization lhs(0.0);
+    EXPECT_THROW(serialization::load(tampered, lhs), std::runtime_error);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, CachedDemangleStableReference)
+{
+    const char* mangled = typeid(serialization::test_position).name();
+
+    const std::string& first  = serialization::cached_demangle(mangled);
+    const std::string& second = serialization::cached_demangle(mangled);
+
+    // A hit returns the same cached node, not a fresh string.
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(serialization::demangle(mangled), first);
+
+    // Distinct symbols get distinct entries.
+    const std::string& other = serialization::cached_demangle(typeid(double).name());
+    EXPECT_NE(&first, &other);
+    EXPECT_EQ(serialization::demangle(typeid(double).name()), other);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, PooledStreamRecyclesAndScrubs)
+{
+    serialization::multi_process_stream* first = nullptr;
+    {
+        serialization::pooled_stream pooled;
+        first = &pooled.stream();
+        pooled->SetSchemaTrusted(true);
+        pooled.stream() << 42;
+    }
+
+    // The next checkout on this thread reuses the returned stream, reset
+    // to its default state.
+    {
+        serialization::pooled_stream pooled;
+        EXPECT_EQ(first, &pooled.stream());
+        EXPECT_TRUE(pooled->Empty());
+        EXPECT_FALSE(pooled->SchemaTrusted());
+    }
+
+    // Nested checkouts get distinct streams.
+    {
+        serialization::pooled_stream outer;
+        serialization::pooled_stream inner;
+        EXPECT_NE(&outer.stream(), &inner.stream());
+    }
+
+    // The facade round trip rides the pool transparently.
+    auto rhs      = std::make_shared<serialization::test_position>();
+    rhs->symbol   = "AAPL";
+    rhs->quantity = 175.50;
+    const serialization::ptr_const<serialization::test_position> ptr = rhs;
+    const auto data = serialization::serialization_impl::access::binary_serialize(ptr);
+    const auto lhs =
+        serialization::serialization_impl::access::binary_deserialize<
+            serialization::test_position>(data);
+    ASSERT_NE(lhs, nullptr);
+    EXPECT_EQ(rhs->symbol, lhs->symbol);
+    EXPECT_DOUBLE_EQ(rhs->quantity, lhs->quantity);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, FixedWidthWireTypes)
+{
+    serialization::multi_process_stream stream;
+
+    // Scalars across the full fixed-width set, including the previously
+    // missing unsigned 64-bit forms.
+    stream << static_cast<short>(-1234);
+    stream << static_cast<unsigned short>(65535U);
+    stream << std::numeric_limits<long long>::min();
+    stream << std::numeric_limits<unsigned long long>::max();
+
+    // size_t occupies 8 bytes on the wire regardless of platform width.
+    const int before = stream.Size();
+    stream << static_cast<size_t>(7);
+    EXPECT_EQ(9, stream.Size() - before);
+
+    short              s  = 0;
+    unsigned short     us = 0;
+    long long          ll = 0;
+    unsigned long long ull = 0;
+    size_t             sz  = 0;
+    stream >> s >> us >> ll >> ull >> sz;
+    EXPECT_EQ(-1234, s);
+    EXPECT_EQ(65535U, us);
+    EXPECT_EQ(std::numeric_limits<long long>::min(), ll);
+    EXPECT_EQ(std::numeric_limits<unsigned long long>::max(), ull);
+    EXPECT_EQ(7U, sz);
+
+    // Bulk array forms round-trip block-copied.
+    const std::vector<uint64_t> rhs64 = {0U, 1U, std::numeric_limits<uint64_t>::max()};
+    stream.Push(rhs64.data(), static_cast<unsigned int>(rhs64.size()));
+    uint64_t*    data64 = nullptr;
+    unsigned int n      = 0;
+    stream.Pop(data64, n);
+    ASSERT_EQ(rhs64.size(), n);
+    EXPECT_EQ(0, std::memcmp(rhs64.data(), data64, n * sizeof(uint64_t)));
+    delete[] data64;
+
+    const std::vector<unsigned short> rhs16 = {0U, 42U, 65535U};
+    stream.Push(rhs16.data(), static_cast<unsigned int>(rhs16.size()));
+    unsigned short* data16 = nullptr;
+    n                      = 0;
+    stream.Pop(data16, n);
+    ASSERT_EQ(rhs16.size(), n);
+    EXPECT_EQ(0, std::memcmp(rhs16.data(), data16, n * sizeof(unsigned short)));
+    delete[] data16;
+
+    // Containers of the new element types take the single-block path
+    // through the reflection layer.
+    serialization::multi_process_stream buffer;
+    const std::vector<uint64_t>         rhs = {1U, 2U, 3U, 4U};
+    std::vector<uint64_t>               lhs;
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+    EXPECT_EQ(rhs, lhs);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, StringDictionaryInterning)
+{
+    const std::string currency = "USD-CALENDAR-NEW-YORK";
+
+    // Repeated values shrink to id-sized back-references.
+    serialization::multi_process_stream plain;
+    serialization::multi_process_stream interned;
+    interned.SetStringInterning(true);
+    for (int i = 0; i < 100; ++i)
+    {
+        plain << currency;
+        interned << currency;
+    }
+    EXPECT_LT(interned.Size(), plain.Size());
+
+    // The record layout is self-describing: extraction needs no mode.
+    for (int i = 0; i < 100; ++i)
+    {
+        std::string out;
+        interned >> out;
+        EXPECT_EQ(currency, out);
+    }
+
+    // string_view extraction of interned occurrences aliases the single
+    // dictionary entry (the first occurrence is still a plain record
+    // viewed in place in the stream buffer).
+    serialization::multi_process_stream shared;
+    shared.SetStringInterning(true);
+    shared << currency << currency << currency;
+    std::string_view first;
+    std::string_view second;
+    std::string_view third;
+    shared >> first >> second >> third;
+    EXPECT_EQ(currency, first);
+    EXPECT_EQ(currency, second);
+    EXPECT_EQ(second.data(), third.data());
+
+    // Below the repeat threshold strings stay ordinary records.
+    serialization::multi_process_stream thresholded;
+    thresholded.SetStringInterning(true, 3);
+    const int single = [&currency]
+    {
+        serialization::multi_process_stream reference;
+        reference << currency;
+        return reference.Size();
+    }();
+    thresholded << currency << currency << currency;
+    EXPECT_EQ(3 * single, thresholded.Size());
+    thresholded << currency;
+    EXPECT_GT(thresholded.Size(), 4 * single - single / 2);
+
+    // A reflected object graph with repeated payload strings round-trips
+    // through the ordinary save/load path.
+    buffer.SetStringInterning(true);
+    std::vector<serialization::test_position> rhs(32);
+    for (auto& position : rhs)
+    {
+        position.symbol   = "EURIBOR-6M";
+        position.quantity = 1.0;
+    }
+    std::vector<serialization::test_position> lhs;
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        EXPECT_EQ(rhs[i].symbol, lhs[i].symbol);
+        EXPECT_DOUBLE_EQ(rhs[i].quantity, lhs[i].quantity);
+    }
+}
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, OrderedContainerHintedLoad)
+{
+    // Large map: the loader appends with an end hint in archive order.
+    std::map<int, double> rhs;
+    for (int i = 0; i < 10000; ++i)
+    {
+        rhs.emplace(i, i * 0.5);
+    }
+    std::map<int, double> lhs;
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+    EXPECT_EQ(rhs, lhs);
+
+    // A custom comparator reverses the iteration order; the archive is
+    // still sorted with respect to it, so the hint stays optimal.
+    buffer.Reset();
+    std::map<int, std::string, std::greater<int>> descending_rhs = {
+        {3, "three"}, {1, "one"}, {2, "two"}};
+    std::map<int, std::string, std::greater<int>> descending_lhs;
+    serialization::save(buffer, descending_rhs);
+    serialization::load(buffer, descending_lhs);
+    EXPECT_EQ(descending_rhs, descending_lhs);
+
+    // Multimaps keep their duplicate keys and relative order.
+    buffer.Reset();
+    std::multimap<std::string, int> multi_rhs = {
+        {"fix", 1}, {"fix", 2}, {"fix", 3}, {"set", 4}};
+    std::multimap<std::string, int> multi_lhs;
+    serialization::save(buffer, multi_rhs);
+    serialization::load(buffer, multi_lhs);
+    EXPECT_EQ(multi_rhs, multi_lhs);
+
+    // Sets take the same hinted path.
+    buffer.Reset();
+    std::set<std::string> set_rhs = {"CHF", "EUR", "GBP", "JPY", "USD"};
+    std::set<std::string> set_lhs;
+    serialization::save(buffer, set_rhs);
+    serialization::load(buffer, set_lhs);
+    EXPECT_EQ(set_rhs, set_lhs);
+}
+
+//----------------------------------------------------------------------------
+namespace
+{
+// Wraps an upstream resource and counts the traffic routed through it,
+// so the test can assert the loaded graph really lands in the arena.
+class counting_memory_resource : public std::pmr::memory_resource
+{
+public:
+    explicit counting_memory_resource(std::pmr::memory_resource* upstream)
+        : upstream_(upstream)
+    {
+    }
+
+    size_t allocations{0};
+    size_t deallocations{0};
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        ++allocations;
+        return upstream_->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+    {
+        ++deallocations;
+        upstream_->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+};
+}  // namespace
+
+//----------------------------------------------------------------------------
+TEST_F(BinarySerializationTest, ArenaBackedDeserialize)
+{
+    // Chain of shared nodes: root plus nested pointer targets.
+    auto head = std::make_shared<serialization::test_node>();
+    auto mid  = std::make_shared<serialization::test_node>();
+    auto tail = std::make_shared<serialization::test_node>();
+    head->value = 1.0;
+    mid->value  = 2.0;
+    tail->value = 3.0;
+    head->next  = mid;
+    mid->next   = tail;
+
+    const serialization::ptr_const<serialization::test_node> ptr = head;
+    const auto data = serialization::serialization_impl::access::binary_serialize(ptr);
+
+    std::pmr::monotonic_buffer_resource arena;
+    counting_memory_resource            counted(&arena);
+    {
+        auto lhs = serialization::serialization_impl::access::binary_deserialize<
+            serialization::test_node>(data, false, &counted);
+        ASSERT_NE(lhs, nullptr);
+        EXPECT_DOUBLE_EQ(1.0, lhs->value);
+        ASSERT_NE(lhs->next, nullptr);
+        EXPECT_DOUBLE_EQ(2.0, lhs->next->value);
+        ASSERT_NE(lhs->next->next, nullptr);
+        EXPECT_DOUBLE_EQ(3.0, lhs->next->next->value);
+
+        // Every node of the graph was constructed out of the arena.
+        EXPECT_GE(counted.allocations, 3U);
+    }
+    // Dropping the graph only runs destructors and returns the bytes.
+    EXPECT_EQ(counted.allocations, counted.deallocations);
+
+    // Without a resource the loader behaves exactly as before.
+    const auto plain = serialization::serialization_impl::access::binary_deserialize<
+        serialization::test_node>(data);
+    ASSERT_NE(plain, nullptr);
+    EXPECT_DOUBLE_EQ(1.0, plain->value);
+}
+
+TEST_F(BinarySerializationTest, CheckedDeserializeSurfacesErrorCodes)
+{
+    using serialization::serialization_impl::access;
+    using error_code = serialization::detail::serialization_error::error_code;
+
+    // A failed check throws in the default build, carrying its code.
+    std::array<int, 3> rhs = {1, 2, 3};
+    std::array<int, 4> lhs = {};
+    serialization::save(buffer, rhs);
+    EXPECT_THROW(serialization::load(buffer, lhs), serialization::detail::serialization_error);
+
+    // Well-formed input: the checked facade returns the value.
+    auto position      = std::make_shared<serialization::test_position>();
+    position->symbol   = "EURUSD";
+    position->quantity = 125.0;
+    const serialization::ptr_const<serialization::test_position> source = position;
+
+    const auto data = access::binary_serialize(source);
+    const auto good = access::binary_deserialize_checked<serialization::test_position>(data);
+    ASSERT_TRUE(good.has_value());
+    EXPECT_EQ("EURUSD", good.value()->symbol);
+    EXPECT_DOUBLE_EQ(125.0, (*good)->quantity);
+
+    // Mismatched archive: the layout fingerprint check rejects it, and
+    // the failure comes back as an error result instead of escaping the
+    // call boundary.
+    auto grid = std::make_shared<serialization::test_grid3>();
+    grid->values = {0.5, 1.5, 2.5};
+    const serialization::ptr_const<serialization::test_grid3> grid_source = grid;
+
+    const auto grid_bytes = access::binary_serialize(grid_source);
+    const auto bad = access::binary_deserialize_checked<serialization::test_grid4>(grid_bytes);
+    ASSERT_FALSE(bad.has_value());
+    EXPECT_FALSE(bad);
+    EXPECT_EQ(error_code::schema_mismatch, bad.error().code);
+}
+
+TEST_F(BinarySerializationTest, SnapshotLogAppendReplayCompact)
+{
+    using serialization::serialization_impl::access;
+    const std::string path = "test_snapshot.log";
+    std::filesystem::remove(path);
+
+    auto make_position = [](const std::string& symbol, double quantity)
+    {
+        auto position      = std::make_shared<serialization::test_position>();
+        position->symbol   = symbol;
+        position->quantity = quantity;
+        return serialization::ptr_const<serialization::test_position>(position);
+    };
+
+    {
+        serialization::snapshot_log log(path);
+        EXPECT_EQ(0U, log.next_index());
+        access::append_to_binary_log(log, "EURUSD", make_position("EURUSD", 100.0));
+        access::append_to_binary_log(log, "USDJPY", make_position("USDJPY", 50.0));
+        // Changed record in a later cycle supersedes the first.
+        access::append_to_binary_log(log, "EURUSD", make_position("EURUSD", 175.0));
+        log.flush();
+    }
+
+    auto objects = access::read_from_binary_log<serialization::test_position>(path);
+    ASSERT_EQ(2U, objects.size());
+    EXPECT_EQ("USDJPY", objects[0].first);
+    EXPECT_DOUBLE_EQ(50.0, objects[0].second->quantity);
+    EXPECT_EQ("EURUSD", objects[1].first);
+    EXPECT_DOUBLE_EQ(175.0, objects[1].second->quantity);
+
+    // Reopening resumes the index sequence past what is on disk.
+    {
+        serialization::snapshot_log log(path);
+        EXPECT_EQ(3U, log.next_index());
+    }
+
+    // Compaction drops the superseded generation; replay is unchanged.
+    const auto before = std::filesystem::file_size(path);
+    serialization::snapshot_log::compact(path);
+    EXPECT_LT(std::filesystem::file_size(path), before);
+
+    objects = access::read_from_binary_log<serialization::test_position>(path);
+    ASSERT_EQ(2U, objects.size());
+    EXPECT_DOUBLE_EQ(50.0, objects[0].second->quantity);
+    EXPECT_DOUBLE_EQ(175.0, objects[1].second->quantity);
+
+    // A torn tail (crash mid-append) is truncated away on reopen.
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        const char garbage[7] = {9, 9, 9, 9, 9, 9, 9};
+        out.write(garbage, sizeof(garbage));
+    }
+    {
+        serialization::snapshot_log log(path);
+        EXPECT_EQ(2U, log.next_index());
+    }
+    objects = access::read_from_binary_log<serialization::test_position>(path);
+    EXPECT_EQ(2U, objects.size());
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(BinarySerializationTest, TeeSerializeFeedsAllSinksInOneTraversal)
+{
+    using serialization::serialization_impl::access;
+
+    auto book   = std::make_shared<serialization::test_book>();
+    book->owner = "desk-7";
+    for (int i = 0; i < 200; ++i)
+    {
+        serialization::test_position position;
+        position.symbol   = "SYM" + std::to_string(i);
+        position.quantity = i * 0.5;
+        book->positions.push_back(position);
+    }
+    const serialization::ptr_const<serialization::test_book> source = book;
+
+    // The tee byte stream must be identical to the single-sink archive.
+    const auto reference = access::binary_serialize(source);
+
+    std::vector<unsigned char> first;
+    std::vector<unsigned char> second;
+    size_t                     second_calls = 0;
+    access::binary_serialize_tee<serialization::test_book>(
+        source,
+        {[&first](const unsigned char* data, size_t size)
+         { first.insert(first.end(), data, data + size); },
+         [&second, &second_calls](const unsigned char* data, size_t size)
+         {
+             ++second_calls;
+             second.insert(second.end(), data, data + size);
+         }},
+        // Small staging buffer: the slow-sink path drains repeatedly.
+        256);
+
+    EXPECT_EQ(reference, first);
+    EXPECT_EQ(reference, second);
+    EXPECT_GT(second_calls, 1U);
+
+    const auto loaded = access::binary_deserialize<serialization::test_book>(second);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ("desk-7", loaded->owner);
+    ASSERT_EQ(200U, loaded->positions.size());
+    EXPECT_DOUBLE_EQ(99.5, loaded->positions[199].quantity);
+
+    // File + extra sink through the convenience wrapper round-trips.
+    const std::string path = "test_tee_output.bin";
+    std::vector<unsigned char> mirror;
+    access::write_to_binary_tee<serialization::test_book>(
+        path,
+        source,
+        {[&mirror](const unsigned char* data, size_t size)
+         { mirror.insert(mirror.end(), data, data + size); }});
+    EXPECT_EQ(reference, mirror);
+
+    const auto from_file = access::read_from_binary<serialization::test_book>(path);
+    ASSERT_NE(from_file, nullptr);
+    EXPECT_EQ(book->positions.size(), from_file->positions.size());
+
+    std::filesystem::remove(path);
+}
+
+namespace serialization
+{
+// Reflection tuple deliberately ordered against the memory layout, so
+// the offset-ordered binary walk and the declaration-ordered text walk
+// diverge.
+class test_shuffled
+{
+public:
+    test_shuffled() = default;
+
+    double      alpha{0};
+    std::string beta;
+    int         gamma{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(test_shuffled, gamma, beta, alpha);
+
+    friend struct serialization::access::serializer;
+};
+}  // namespace serialization
+
+TEST_F(BinarySerializationTest, OffsetOrderedTraversalRoundTrip)
+{
+    using serialization::serialization_impl::access;
+
+    auto record   = std::make_shared<serialization::test_shuffled>();
+    record->alpha = 2.75;
+    record->beta  = "mid";
+    record->gamma = -3;
+    const serialization::ptr_const<serialization::test_shuffled> source = record;
+
+    // Binary: save and load share the offset-sorted plan, so the
+    // positional wire stays consistent.
+    const auto bytes  = access::binary_serialize(source);
+    const auto loaded = access::binary_deserialize<serialization::test_shuffled>(bytes);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_DOUBLE_EQ(2.75, loaded->alpha);
+    EXPECT_EQ("mid", loaded->beta);
+    EXPECT_EQ(-3, loaded->gamma);
+
+    // Containers of such objects take the same plan per element.
+    std::vector<serialization::test_shuffled> rhs(64);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].alpha = static_cast<double>(i);
+        rhs[i].beta  = std::to_string(i);
+        rhs[i].gamma = static_cast<int>(i) * 2;
+    }
+    std::vector<serialization::test_shuffled> lhs;
+    serialization::save(buffer, rhs);
+    serialization::load(buffer, lhs);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    EXPECT_DOUBLE_EQ(63.0, lhs[63].alpha);
+    EXPECT_EQ("63", lhs[63].beta);
+    EXPECT_EQ(126, lhs[63].gamma);
+
+    // Text archivers keep the reflection-tuple order readers expect.
+    serialization::json value;
+    access::json_serialize(value, source);
+    std::vector<std::string> keys;
+    for (const auto& item : value["root"].items())
+    {
+        keys.push_back(item.key());
+    }
+    const std::vector<std::string> expected = {"Class", "gamma", "beta", "alpha"};
+    EXPECT_EQ(expected, keys);
+}
+
+TEST_F(BinarySerializationTest, ArchiveStoreBatchedWriteLookupIterate)
+{
+    using serialization::serialization_impl::access;
+    const std::string path = "test_archive_store.bin";
+    std::filesystem::remove(path);
+
+    std::vector<std::pair<std::string, serialization::ptr_const<serialization::test_position>>>
+        objects;
+    for (int i = 0; i < 16; ++i)
+    {
+        auto position      = std::make_shared<serialization::test_position>();
+        position->symbol   = "SYM" + std::to_string(i);
+        position->quantity = i * 1.25;
+        objects.emplace_back("entry" + std::to_string(i), position);
+    }
+    access::write_to_archive_store(path, objects);
+
+    // One open serves any number of keyed lookups; a hit touches only
+    // that entry's bytes.
+    serialization::archive_store store(path);
+    EXPECT_EQ(16U, store.size());
+    EXPECT_TRUE(store.contains("entry0"));
+    EXPECT_FALSE(store.contains("entry16"));
+
+    const auto hit =
+        access::read_from_archive_store<serialization::test_position>(store, "entry7");
+    ASSERT_NE(hit, nullptr);
+    EXPECT_EQ("SYM7", hit->symbol);
+    EXPECT_DOUBLE_EQ(8.75, hit->quantity);
+
+    const auto miss =
+        access::read_from_archive_store<serialization::test_position>(store, "missing");
+    EXPECT_EQ(miss, nullptr);
+
+    // Iteration preserves write order.
+    ASSERT_EQ(16U, store.keys().size());
+    EXPECT_EQ("entry0", store.keys().front());
+    EXPECT_EQ("entry15", store.keys().back());
+
+    const auto all = access::read_archive_store<serialization::test_position>(path);
+    ASSERT_EQ(16U, all.size());
+    EXPECT_EQ("entry3", all[3].first);
+    EXPECT_DOUBLE_EQ(3.75, all[3].second->quantity);
+
+    // A file that is not a store is rejected on open.
+    const std::string bogus = "test_archive_store_bogus.bin";
+    {
+        std::ofstream out(bogus, std::ios::binary);
+        out << "not a store";
+    }
+    EXPECT_THROW(serialization::archive_store{bogus}, std::runtime_error);
+
+    std::filesystem::remove(bogus);
+    std::filesystem::remove(path);
+}
+
+TEST_F(BinarySerializationTest, PipelinedReadOverlapsChunkedDecode)
+{
+    using serialization::serialization_impl::access;
+    const std::string path = "test_pipelined.bin";
+    std::filesystem::remove(path);
+
+    auto book   = std::make_shared<serialization::test_book>();
+    book->owner = "overnight-batch";
+    for (int i = 0; i < 500; ++i)
+    {
+        serialization::test_position position;
+        position.symbol   = "SYM" + std::to_string(i);
+        position.quantity = i * 0.25;
+        book->positions.push_back(position);
+    }
+    const serialization::ptr_const<serialization::test_book> source = book;
+    access::write_to_binary(path, source);
+
+    // A chunk far smaller than the archive forces many ring handoffs and
+    // values straddling chunk boundaries.
+    const auto loaded =
+        access::read_from_binary_pipelined<serialization::test_book>(path, 512, 2);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_EQ("overnight-batch", loaded->owner);
+    ASSERT_EQ(500U, loaded->positions.size());
+    EXPECT_EQ("SYM499", loaded->positions[499].symbol);
+    EXPECT_DOUBLE_EQ(124.75, loaded->positions[499].quantity);
+
+    // An archive smaller than one chunk takes a single handoff.
+    const auto whole =
+        access::read_from_binary_pipelined<serialization::test_book>(path);
+    ASSERT_NE(whole, nullptr);
+    EXPECT_EQ(500U, whole->positions.size());
+
+    // Compressed archives are routed through the block-parallel path.
+    access::write_to_binary(path, source, serialization::compression_codec::lz);
+    const auto compressed =
+        access::read_from_binary_pipelined<serialization::test_book>(path, 512, 2);
+    ASSERT_NE(compressed, nullptr);
+    EXPECT_EQ("overnight-batch", compressed->owner);
+    EXPECT_EQ(500U, compressed->positions.size());
+
+    EXPECT_EQ(
+        nullptr,
+        access::read_from_binary_pipelined<serialization::test_book>("test_pipelined_missing.bin"));
+
+    std::filesystem::remove(path);
+}
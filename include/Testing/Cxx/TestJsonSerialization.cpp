@@ -3,12 +3,15 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <filesystem>
 #include <map>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include "common/serialization_macros.h"
 #include "serialization.h"
@@ -51,6 +54,64 @@ private:
 };
 
 SERIALIZATION_REGISTER_DERIVED_SERIALIZATION(test_derived_serialization);
+
+class test_portfolio
+{
+public:
+    test_portfolio(std::string name, std::vector<double> values) :
+        name_(std::move(name)), values_(std::move(values))
+    {
+        weights_["base"] = 1;
+    }
+
+    const auto& name() const { return name_; }
+    const auto& values() const { return values_; }
+
+private:
+    void initialize() {};
+    test_portfolio() = default;
+    SERIALIZATION_MACRO(test_portfolio, name_, values_, weights_, note_);
+
+    std::string                name_;
+    std::vector<double>        values_;
+    std::map<std::string, int> weights_;
+    std::optional<std::string> note_{"steady"};
+};
+class test_row
+{
+public:
+    test_row() = default;
+
+    double      price{0};
+    int         quantity{0};
+    std::string label;
+
+private:
+    void initialize() {};
+    SERIALIZATION_MACRO(test_row, price, quantity, label);
+};
+
+enum class test_compounding
+{
+    annual     = 0,
+    quarterly  = 1,
+    continuous = 2
+};
+
+// Result-export row: the enum member repeats per row, the shape the
+// dictionary-encoded mode compacts.
+class test_rate_row
+{
+public:
+    test_rate_row() = default;
+
+    double           rate{0};
+    test_compounding compounding{test_compounding::annual};
+
+private:
+    void initialize() {};
+    SERIALIZATION_MACRO(test_rate_row, rate, compounding);
+};
 }  // namespace test
 
 //=============================================================================
@@ -201,3 +262,350 @@ TEST_F(JsonSerializationTest, VariantSerialization)
     serialization::load(buffer, lhs);
     EXPECT_EQ(rhs, lhs);
 }
+
+
+//=============================================================================
+// Streaming Emitter Tests
+//=============================================================================
+
+TEST_F(JsonSerializationTest, EmitterMatchesDomOutput)
+{
+    const auto rhs = std::make_shared<test::test_portfolio>(
+        "books \"A\"", std::vector<double>{1.5, -2.25, 0.0});
+
+    serialization::ptr_const<test::test_portfolio> ptr = rhs;
+    serialization::save(buffer, ptr);
+
+    // The SAX path writes the same document the DOM path does, without
+    // ever building the node tree.
+    const std::string compact =
+        serialization::serialization_impl::access::json_serialize_compact(ptr);
+    EXPECT_EQ(buffer, serialization::json::parse(compact));
+
+    // And the emitted text loads back through the ordinary DOM loader.
+    serialization::json parsed = serialization::json::parse(compact);
+    serialization::ptr_const<test::test_portfolio> lhs;
+    serialization::load(parsed, lhs);
+    ASSERT_NE(nullptr, lhs);
+    EXPECT_EQ(rhs->name(), lhs->name());
+    EXPECT_EQ(rhs->values(), lhs->values());
+}
+
+TEST_F(JsonSerializationTest, EmitterSinkChunksDocument)
+{
+    const auto rhs = std::make_shared<test::test_portfolio>(
+        "chunked", std::vector<double>(100, 3.25));
+    serialization::ptr_const<test::test_portfolio> ptr = rhs;
+
+    std::string collected;
+    size_t      chunk_count = 0;
+    serialization::json_emitter emitter(
+        [&collected, &chunk_count](const char* data, size_t size)
+        {
+            collected.append(data, size);
+            ++chunk_count;
+        },
+        64);
+    serialization::save<serialization::json_emitter,
+                        serialization::ptr_const<test::test_portfolio>>(emitter, ptr);
+    emitter.Flush();
+
+    EXPECT_GT(chunk_count, 1U);
+    EXPECT_EQ(
+        serialization::serialization_impl::access::json_serialize_compact(ptr), collected);
+}
+
+TEST_F(JsonSerializationTest, WriteJsonStreamedAndCompact)
+{
+    const auto rhs = std::make_shared<test::test_portfolio>(
+        "streamed", std::vector<double>(500, 0.625));
+    serialization::ptr_const<test::test_portfolio> ptr = rhs;
+    serialization::save(buffer, ptr);
+
+    serialization::serialization_impl::access::write_json("test_write_json_pretty.json", buffer);
+    serialization::serialization_impl::access::write_json(
+        "test_write_json_compact.json", buffer, true);
+
+    // Both forms read back to the same document; compact drops only the
+    // indentation whitespace.
+    serialization::json pretty;
+    serialization::json compact;
+    serialization::serialization_impl::access::read_json("test_write_json_pretty.json", pretty);
+    serialization::serialization_impl::access::read_json("test_write_json_compact.json", compact);
+    EXPECT_EQ(buffer, pretty);
+    EXPECT_EQ(buffer, compact);
+    EXPECT_LT(
+        std::filesystem::file_size("test_write_json_compact.json"),
+        std::filesystem::file_size("test_write_json_pretty.json"));
+    std::filesystem::remove("test_write_json_pretty.json");
+    std::filesystem::remove("test_write_json_compact.json");
+}
+
+TEST_F(JsonSerializationTest, MsgpackAndCborRoundTrip)
+{
+    const auto rhs = std::make_shared<test::test_portfolio>(
+        "binary encodings", std::vector<double>{2.5, 3.5, -1.0});
+    serialization::ptr_const<test::test_portfolio> ptr = rhs;
+
+    serialization::serialization_impl::access::write_to_msgpack("test_portfolio.msgpack", ptr);
+    auto from_msgpack = serialization::serialization_impl::access::read_from_msgpack<
+        test::test_portfolio>("test_portfolio.msgpack");
+    ASSERT_NE(nullptr, from_msgpack);
+    EXPECT_EQ(rhs->name(), from_msgpack->name());
+    EXPECT_EQ(rhs->values(), from_msgpack->values());
+
+    serialization::serialization_impl::access::write_to_cbor("test_portfolio.cbor", ptr);
+    auto from_cbor = serialization::serialization_impl::access::read_from_cbor<
+        test::test_portfolio>("test_portfolio.cbor");
+    ASSERT_NE(nullptr, from_cbor);
+    EXPECT_EQ(rhs->name(), from_cbor->name());
+    EXPECT_EQ(rhs->values(), from_cbor->values());
+
+    // The binary encodings undercut the text dump for the same document.
+    const std::string text = serialization::serialization_impl::access::print(ptr);
+    EXPECT_LT(std::filesystem::file_size("test_portfolio.msgpack"), text.size());
+    EXPECT_LT(std::filesystem::file_size("test_portfolio.cbor"), text.size());
+    std::filesystem::remove("test_portfolio.msgpack");
+    std::filesystem::remove("test_portfolio.cbor");
+}
+
+TEST_F(JsonSerializationTest, InternedKeysAreStable)
+{
+    // Repeated lookups hand back the same cached string, so field access
+    // in the archiver no longer allocates per call.
+    const std::string& first  = serialization::interned_key("d_");
+    const std::string& second = serialization::interned_key("d_");
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ("d_", first);
+    EXPECT_NE(&first, &serialization::interned_key("n_"));
+}
+
+TEST_F(JsonSerializationTest, OutOfOrderFieldsLoad)
+{
+    // Fields are matched by name in a single pass over the object, so a
+    // document whose keys differ from the reflection order still loads;
+    // unknown keys are skipped and absent members keep their defaults.
+    buffer = serialization::json::parse(R"({
+        "label": "reordered",
+        "vendor_extension": true,
+        "price": 2.5,
+        "Class": "test::test_row"
+    })");
+
+    test::test_row row;
+    row.quantity = 7;
+    serialization::load(buffer, row);
+    EXPECT_DOUBLE_EQ(2.5, row.price);
+    EXPECT_EQ("reordered", row.label);
+    EXPECT_EQ(7, row.quantity);
+}
+
+TEST_F(JsonSerializationTest, ParallelContainerLoadMatchesSequential)
+{
+    std::vector<test::test_row> rhs(2048);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].price    = static_cast<double>(i) * 0.25;
+        rhs[i].quantity = static_cast<int>(i);
+        rhs[i].label    = "row" + std::to_string(i % 32);
+    }
+    serialization::save(buffer, rhs);
+
+    // Each array element is an independent subtree, so the workers load
+    // straight into pre-sized slots; the result matches a sequential load.
+    std::vector<test::test_row> lhs;
+    {
+        serialization::parallel_load_scope scope(4);
+        serialization::load(buffer, lhs);
+    }
+    ASSERT_EQ(rhs.size(), lhs.size());
+    for (size_t i = 0; i < rhs.size(); i += 257)
+    {
+        EXPECT_DOUBLE_EQ(rhs[i].price, lhs[i].price);
+        EXPECT_EQ(rhs[i].quantity, lhs[i].quantity);
+        EXPECT_EQ(rhs[i].label, lhs[i].label);
+    }
+}
+
+TEST_F(JsonSerializationTest, ColumnarContainerRoundTrip)
+{
+    std::vector<test::test_row> rhs(50);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].price    = static_cast<double>(i) * 1.25;
+        rhs[i].quantity = static_cast<int>(i);
+        rhs[i].label    = "row";
+    }
+
+    // Opt in for the save; the struct-of-arrays object names each field
+    // once instead of once per element.
+    {
+        serialization::columnar_json_scope scope;
+        serialization::save(buffer, rhs);
+    }
+    ASSERT_TRUE(buffer.is_object());
+    ASSERT_TRUE(buffer.contains("Columns"));
+    EXPECT_EQ(50U, buffer["Size"].get<size_t>());
+    EXPECT_EQ(50U, buffer["Columns"]["price"].size());
+
+    // Loading needs no scope: the columnar object is recognized and
+    // re-inflated transparently.
+    std::vector<test::test_row> lhs;
+    serialization::load(buffer, lhs);
+    ASSERT_EQ(rhs.size(), lhs.size());
+    EXPECT_DOUBLE_EQ(rhs[49].price, lhs[49].price);
+    EXPECT_EQ(rhs[49].quantity, lhs[49].quantity);
+    EXPECT_EQ("row", lhs[49].label);
+
+    // Without the scope the layout stays the ordinary array of objects.
+    serialization::json row_layout;
+    serialization::save(row_layout, rhs);
+    EXPECT_TRUE(row_layout.is_array());
+    EXPECT_LT(buffer.dump().size(), row_layout.dump().size());
+}
+
+TEST_F(JsonSerializationTest, PackedNumericContainerRoundTrip)
+{
+    std::vector<double> rhs(256);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i] = static_cast<double>(i) / 3.0 - 42.0;
+    }
+
+    {
+        serialization::packed_numeric_scope scope;
+        serialization::save(buffer, rhs);
+    }
+    ASSERT_TRUE(buffer.is_object());
+    ASSERT_TRUE(buffer.contains("Packed"));
+    EXPECT_EQ(256U, buffer["Size"].get<size_t>());
+
+    // Decoding is transparent and exact: the blob carries the raw bytes.
+    std::vector<double> lhs;
+    serialization::load(buffer, lhs);
+    EXPECT_EQ(rhs, lhs);
+
+    // The packed record undercuts the per-element array by a wide margin.
+    serialization::json plain;
+    serialization::save(plain, rhs);
+    EXPECT_TRUE(plain.is_array());
+    EXPECT_LT(buffer.dump().size(), plain.dump().size());
+}
+
+TEST_F(JsonSerializationTest, DeltaPatchRoundTrip)
+{
+    std::vector<test::test_row> baseline(50);
+    for (size_t i = 0; i < baseline.size(); ++i)
+    {
+        baseline[i].price    = static_cast<double>(i);
+        baseline[i].quantity = static_cast<int>(i);
+        baseline[i].label    = "row" + std::to_string(i);
+    }
+
+    // One pillar moves: the patch carries exactly the two touched leaves
+    // under their stable dotted paths.
+    std::vector<test::test_row> current = baseline;
+    current[7].price                    = 7.25;
+    current[31].label                   = "renamed";
+
+    const serialization::json patch = serialization::serialize_delta(baseline, current);
+    ASSERT_EQ(2U, patch.size());
+    EXPECT_DOUBLE_EQ(7.25, patch.at("7.price").get<double>());
+    EXPECT_EQ("renamed", patch.at("31.label").get<std::string>());
+
+    std::vector<test::test_row> replica = baseline;
+    serialization::apply_delta(patch, replica);
+    EXPECT_DOUBLE_EQ(current[7].price, replica[7].price);
+    EXPECT_EQ(current[31].label, replica[31].label);
+    EXPECT_EQ(current[8].quantity, replica[8].quantity);
+
+    // A size change cannot be patched leaf-wise: the container subtree is
+    // replaced wholesale and still applies cleanly.
+    current.emplace_back();
+    current.back().label = "appended";
+
+    const serialization::json resize_patch = serialization::serialize_delta(baseline, current);
+    ASSERT_EQ(1U, resize_patch.size());
+    serialization::apply_delta(resize_patch, replica);
+    ASSERT_EQ(current.size(), replica.size());
+    EXPECT_EQ("appended", replica.back().label);
+}
+
+TEST_F(JsonSerializationTest, DirtyFieldDeltaSaveAndMerge)
+{
+    static_assert(serialization::field_index<test::test_row>("price") == 0);
+    static_assert(serialization::field_index<test::test_row>("label") == 2);
+    static_assert(
+        serialization::field_index<test::test_row>("missing") == serialization::dirty_mask::npos);
+
+    test::test_row row;
+    row.price    = 10.0;
+    row.quantity = 3;
+    row.label    = "baseline";
+    serialization::save(buffer, row);
+
+    // Mutate two members and save only those against the baseline.
+    row.price = 12.5;
+    row.label = "updated";
+    serialization::dirty_mask mask;
+    mask.mark(serialization::field_index<test::test_row>("price"));
+    mask.mark(serialization::field_index<test::test_row>("label"));
+
+    serialization::json delta;
+    {
+        serialization::dirty_fields_scope scope(row, mask);
+        serialization::save(delta, row);
+    }
+    EXPECT_TRUE(delta.contains("price"));
+    EXPECT_TRUE(delta.contains("label"));
+    EXPECT_FALSE(delta.contains("quantity"));
+
+    // Compacting the delta into the baseline archive yields a full
+    // archive with the updated members applied.
+    serialization::merge_delta(buffer, delta);
+    test::test_row loaded;
+    serialization::load(buffer, loaded);
+    EXPECT_DOUBLE_EQ(12.5, loaded.price);
+    EXPECT_EQ(3, loaded.quantity);
+    EXPECT_EQ("updated", loaded.label);
+}
+
+//=============================================================================
+// Dictionary-Encoded Enum Tests
+//=============================================================================
+
+TEST_F(JsonSerializationTest, DictionaryEncodedEnums)
+{
+    auto rhs         = std::make_shared<test::test_rate_row>();
+    rhs->rate        = 0.05;
+    rhs->compounding = test::test_compounding::quarterly;
+
+    const serialization::ptr_const<test::test_rate_row> ptr = rhs;
+
+    // The default mode spells enums out as strings.
+    serialization::json plain;
+    serialization::serialization_impl::access::json_serialize(plain, ptr);
+    EXPECT_TRUE(plain["root"]["compounding"].is_string());
+
+    // Dictionary mode stores the underlying integer and collects a
+    // one-time name table under the archive root.
+    serialization::json compact;
+    serialization::serialization_impl::access::json_serialize_dictionary_enums(compact, ptr);
+    EXPECT_TRUE(compact["root"]["compounding"].is_number_integer());
+    EXPECT_EQ(1, compact["root"]["compounding"].get<int>());
+
+    ASSERT_TRUE(compact.contains(std::string(serialization::ENUM_DICTIONARY_NAME)));
+    const auto& dictionary = compact[std::string(serialization::ENUM_DICTIONARY_NAME)];
+    ASSERT_EQ(1U, dictionary.size());
+    const auto& names = dictionary.begin().value();
+    ASSERT_EQ(1U, names.size());
+    EXPECT_EQ(1, names.begin().value().get<int>());
+
+    // Compact archives load through the ordinary integer branch — no
+    // matching load-side mode is required.
+    serialization::ptr_const<test::test_rate_row> lhs;
+    serialization::serialization_impl::access::json_deserialize(compact, lhs);
+    ASSERT_NE(lhs, nullptr);
+    EXPECT_DOUBLE_EQ(0.05, lhs->rate);
+    EXPECT_EQ(test::test_compounding::quarterly, lhs->compounding);
+}
@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/serialization_macros.h"
+#include "serialization.h"
+#include "serialization_impl.h"
+#include "support/payload_generator.h"
+#include "util/multi_process_stream.h"
+
+//=============================================================================
+// Test Classes
+//=============================================================================
+
+namespace serialization
+{
+class gen_position
+{
+public:
+    gen_position() = default;
+
+    std::string                symbol;
+    double                     quantity{0};
+    std::optional<std::string> venue;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(gen_position, symbol, quantity, venue);
+
+    friend struct serialization::access::serializer;
+};
+
+// Skewed production-like shape: strings, containers, optionals and a
+// pointer chain in one type.
+class gen_portfolio
+{
+public:
+    gen_portfolio() = default;
+
+    std::string                    owner;
+    std::vector<gen_position>      positions;
+    std::map<std::string, double>  curve;
+    std::optional<double>          nav;
+    std::shared_ptr<gen_portfolio> parent;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(gen_portfolio, owner, positions, curve, nav, parent);
+
+    friend struct serialization::access::serializer;
+};
+
+// Polymorphic pair for the weighted mix.
+class gen_instrument
+{
+public:
+    gen_instrument()          = default;
+    virtual ~gen_instrument() = default;
+
+    double      notional{0};
+    std::string name;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(gen_instrument, notional, name);
+
+    friend struct serialization::access::serializer;
+};
+
+class gen_swap : public gen_instrument
+{
+public:
+    gen_swap() = default;
+
+    double fixed_rate{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(gen_swap, fixed_rate);
+
+    friend struct serialization::access::serializer;
+};
+
+// Holder whose pointer member drives the polymorphism mix.
+class gen_trade
+{
+public:
+    gen_trade() = default;
+
+    std::shared_ptr<gen_instrument> instrument;
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(gen_trade, instrument);
+
+    friend struct serialization::access::serializer;
+};
+}  // namespace serialization
+
+namespace
+{
+//----------------------------------------------------------------------------
+std::vector<unsigned char> serialize_bytes(const serialization::gen_portfolio& portfolio)
+{
+    serialization::multi_process_stream stream;
+    serialization::save(stream, portfolio);
+    return std::move(stream).TakeRawData();
+}
+}  // namespace
+
+//=============================================================================
+// Test Fixture
+//=============================================================================
+
+class PayloadGeneratorTest : public ::testing::Test
+{
+};
+
+//=============================================================================
+// Test Cases
+//=============================================================================
+
+//----------------------------------------------------------------------------
+TEST_F(PayloadGeneratorTest, DeterministicForSeed)
+{
+    serialization::testing::payload_config config;
+    config.seed = 42;
+
+    serialization::testing::payload_generator first(config);
+    serialization::testing::payload_generator second(config);
+
+    const auto lhs = first.generate<serialization::gen_portfolio>();
+    const auto rhs = second.generate<serialization::gen_portfolio>();
+    EXPECT_EQ(serialize_bytes(lhs), serialize_bytes(rhs));
+
+    config.seed = 43;
+    serialization::testing::payload_generator other(config);
+    const auto different = other.generate<serialization::gen_portfolio>();
+    EXPECT_NE(serialize_bytes(lhs), serialize_bytes(different));
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PayloadGeneratorTest, ConfigShapesTheGraph)
+{
+    serialization::testing::payload_config config;
+    config.seed               = 7;
+    config.min_container_size = 3;
+    config.max_container_size = 5;
+    config.min_string_length  = 8;
+    config.max_string_length  = 12;
+    config.optional_density   = 1.0;
+    config.pointer_density    = 0.0;
+
+    serialization::testing::payload_generator generator(config);
+    const auto portfolio = generator.generate<serialization::gen_portfolio>();
+
+    EXPECT_GE(portfolio.owner.size(), 8u);
+    EXPECT_LE(portfolio.owner.size(), 12u);
+    EXPECT_GE(portfolio.positions.size(), 3u);
+    EXPECT_LE(portfolio.positions.size(), 5u);
+    EXPECT_GE(portfolio.curve.size(), 3u);
+    EXPECT_LE(portfolio.curve.size(), 5u);
+    ASSERT_TRUE(portfolio.nav.has_value());
+    EXPECT_EQ(nullptr, portfolio.parent);
+    for (const auto& position : portfolio.positions)
+    {
+        ASSERT_TRUE(position.venue.has_value());
+        EXPECT_GE(position.venue->size(), 8u);
+        EXPECT_LE(position.venue->size(), 12u);
+    }
+
+    // Density zero leaves every optional empty.
+    config.optional_density = 0.0;
+    serialization::testing::payload_generator sparse(config);
+    const auto empty = sparse.generate<serialization::gen_portfolio>();
+    EXPECT_FALSE(empty.nav.has_value());
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PayloadGeneratorTest, PointerDepthIsCapped)
+{
+    serialization::testing::payload_config config;
+    config.seed               = 11;
+    config.pointer_density    = 1.0;
+    config.max_depth          = 4;
+    config.min_container_size = 0;
+    config.max_container_size = 1;
+
+    serialization::testing::payload_generator generator(config);
+    const auto portfolio = generator.generate<serialization::gen_portfolio>();
+
+    size_t depth = 0;
+    for (const auto* node = &portfolio; node->parent != nullptr; node = node->parent.get())
+    {
+        ++depth;
+        ASSERT_LE(depth, config.max_depth);
+    }
+    EXPECT_GT(depth, 0u);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PayloadGeneratorTest, WeightedPolymorphismMix)
+{
+    serialization::testing::payload_config config;
+    config.seed            = 19;
+    config.pointer_density = 1.0;
+
+    serialization::testing::payload_generator generator(config);
+    generator.register_derived<serialization::gen_instrument, serialization::gen_swap>(2.0);
+
+    size_t base_count    = 0;
+    size_t derived_count = 0;
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto trade = generator.generate<serialization::gen_trade>();
+        ASSERT_NE(nullptr, trade.instrument);
+        if (dynamic_cast<const serialization::gen_swap*>(trade.instrument.get()) != nullptr)
+        {
+            ++derived_count;
+        }
+        else
+        {
+            ++base_count;
+        }
+    }
+
+    // Weight 2 against the base's implicit 1: both appear, derived more
+    // often.
+    EXPECT_GT(base_count, 0u);
+    EXPECT_GT(derived_count, base_count);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PayloadGeneratorTest, GeneratedGraphRoundTrips)
+{
+    serialization::testing::payload_config config;
+    config.seed = 23;
+
+    serialization::testing::payload_generator generator(config);
+    const auto portfolio = generator.generate<serialization::gen_portfolio>();
+
+    serialization::multi_process_stream stream;
+    serialization::save(stream, portfolio);
+    auto buffer = std::move(stream).TakeRawData();
+
+    serialization::multi_process_stream source;
+    source.SetRawData(buffer.data(), buffer.size());
+    serialization::gen_portfolio loaded;
+    serialization::load(source, loaded);
+
+    EXPECT_EQ(serialize_bytes(portfolio), serialize_bytes(loaded));
+}
@@ -0,0 +1,314 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/serialization_macros.h"
+#include "serialization.h"
+#include "serialization_impl.h"
+#include "util/multi_process_stream.h"
+
+//=============================================================================
+// Test Classes
+//=============================================================================
+
+namespace serialization
+{
+// Padding-free scalar record eligible for the memcpy fast path; mirrors
+// the canonical tick record in TestBinarySerialization.cpp.
+class perf_tick_record
+{
+public:
+    perf_tick_record() = default;
+
+    double  price{0};
+    double  volume{0};
+    int64_t timestamp{0};
+    int32_t venue{0};
+    int32_t flags{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(perf_tick_record, price, volume, timestamp, venue, flags);
+
+    friend struct serialization::access::serializer;
+};
+
+// Position-style record with a string member, so container saves take
+// the element-by-element path rather than a block write.
+class perf_position
+{
+public:
+    perf_position() = default;
+
+    std::string symbol;
+    double      quantity{0};
+
+private:
+    void initialize() {}
+    SERIALIZATION_MACRO(perf_position, symbol, quantity);
+
+    friend struct serialization::access::serializer;
+};
+}  // namespace serialization
+
+namespace
+{
+#ifndef SERIALIZATION_PERF_BASELINE_FILE
+#define SERIALIZATION_PERF_BASELINE_FILE "perf_baselines.json"
+#endif
+
+// Fail when current throughput drops more than this fraction below the
+// stored baseline.
+constexpr double kRegressionTolerance = 0.10;
+
+// Best-of-N measurement: the fastest repetition is the least disturbed
+// by scheduling noise, so it is the number stored and compared.
+constexpr int kRepetitions = 7;
+
+//----------------------------------------------------------------------------
+template <typename Body>
+double measure_mb_per_s(size_t bytes, Body&& body)
+{
+    // One untimed pass warms the allocator and caches so the timed
+    // repetitions measure steady-state throughput.
+    body();
+
+    double best_seconds = 0;
+    for (int rep = 0; rep < kRepetitions; ++rep)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto stop = std::chrono::steady_clock::now();
+
+        const double seconds = std::chrono::duration<double>(stop - start).count();
+        if (rep == 0 || seconds < best_seconds)
+        {
+            best_seconds = seconds;
+        }
+    }
+    return static_cast<double>(bytes) / (best_seconds * 1024.0 * 1024.0);
+}
+}  // namespace
+
+//=============================================================================
+// Test Fixture
+//=============================================================================
+
+// Compares binary save/load throughput for the canonical payloads
+// against machine-readable baselines stored in-tree. Set
+// SERIALIZATION_PERF_BASELINE_UPDATE=1 in the environment to record the
+// current machine's numbers instead of checking them; cases without a
+// stored baseline skip rather than fail, so a fresh checkout stays
+// green until baselines are captured.
+class PerformanceRegressionTest : public ::testing::Test
+{
+protected:
+    static bool update_requested()
+    {
+        const char* flag = std::getenv("SERIALIZATION_PERF_BASELINE_UPDATE");
+        return flag != nullptr && flag[0] != '\0' && flag[0] != '0';
+    }
+
+    static serialization::json read_baselines()
+    {
+        std::ifstream file(SERIALIZATION_PERF_BASELINE_FILE);
+        if (!file.is_open())
+        {
+            return serialization::json::object();
+        }
+        return serialization::json::parse(file, nullptr, false);
+    }
+
+    // Either records the measurement as the new baseline or asserts it
+    // has not regressed beyond the tolerance.
+    static void check_throughput(const std::string& case_name, double mb_per_s)
+    {
+        serialization::json baselines = read_baselines();
+        if (baselines.is_discarded())
+        {
+            baselines = serialization::json::object();
+        }
+
+        if (update_requested())
+        {
+            baselines[case_name]["throughput_mb_per_s"] = mb_per_s;
+            std::ofstream file(SERIALIZATION_PERF_BASELINE_FILE);
+            ASSERT_TRUE(file.is_open())
+                << "cannot write baseline file " << SERIALIZATION_PERF_BASELINE_FILE;
+            file << baselines.dump(4) << '\n';
+            return;
+        }
+
+        if (!baselines.contains(case_name))
+        {
+            GTEST_SKIP() << "no stored baseline for " << case_name
+                         << "; run with SERIALIZATION_PERF_BASELINE_UPDATE=1 to record one";
+        }
+
+        const double baseline = baselines[case_name]["throughput_mb_per_s"].get<double>();
+        const double floor    = baseline * (1.0 - kRegressionTolerance);
+        EXPECT_GE(mb_per_s, floor)
+            << case_name << " regressed: " << mb_per_s << " MB/s against a baseline of "
+            << baseline << " MB/s (floor " << floor << " MB/s)";
+    }
+};
+
+//=============================================================================
+// Test Cases
+//=============================================================================
+
+//----------------------------------------------------------------------------
+TEST_F(PerformanceRegressionTest, BinarySaveBulkDoubles)
+{
+    std::vector<double> values(1 << 20);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<double>(i) * 0.25;
+    }
+
+    const size_t bytes = values.size() * sizeof(double);
+
+    const double mb_per_s = measure_mb_per_s(
+        bytes,
+        [&]()
+        {
+            serialization::multi_process_stream stream;
+            serialization::save(stream, values);
+        });
+    check_throughput("BinarySaveBulkDoubles", mb_per_s);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PerformanceRegressionTest, BinaryLoadBulkDoubles)
+{
+    std::vector<double> values(1 << 20);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<double>(i) * 0.25;
+    }
+
+    serialization::multi_process_stream stream;
+    serialization::save(stream, values);
+    auto buffer = std::move(stream).TakeRawData();
+
+    const size_t bytes = values.size() * sizeof(double);
+
+    const double mb_per_s = measure_mb_per_s(
+        bytes,
+        [&]()
+        {
+            serialization::multi_process_stream source;
+            source.SetRawData(buffer);
+            std::vector<double> loaded;
+            serialization::load(source, loaded);
+        });
+    check_throughput("BinaryLoadBulkDoubles", mb_per_s);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PerformanceRegressionTest, BinarySaveTickRecords)
+{
+    std::vector<serialization::perf_tick_record> ticks(200000);
+    for (size_t i = 0; i < ticks.size(); ++i)
+    {
+        ticks[i].price     = static_cast<double>(i) + 0.5;
+        ticks[i].volume    = static_cast<double>(i % 1000);
+        ticks[i].timestamp = static_cast<int64_t>(i) * 1000;
+        ticks[i].venue     = static_cast<int32_t>(i % 7);
+        ticks[i].flags     = static_cast<int32_t>(i % 3);
+    }
+
+    const size_t bytes = ticks.size() * sizeof(serialization::perf_tick_record);
+
+    const double mb_per_s = measure_mb_per_s(
+        bytes,
+        [&]()
+        {
+            serialization::multi_process_stream stream;
+            serialization::save(stream, ticks);
+        });
+    check_throughput("BinarySaveTickRecords", mb_per_s);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PerformanceRegressionTest, BinaryLoadTickRecords)
+{
+    std::vector<serialization::perf_tick_record> ticks(200000);
+    for (size_t i = 0; i < ticks.size(); ++i)
+    {
+        ticks[i].price     = static_cast<double>(i) + 0.5;
+        ticks[i].timestamp = static_cast<int64_t>(i) * 1000;
+    }
+
+    serialization::multi_process_stream stream;
+    serialization::save(stream, ticks);
+    auto buffer = std::move(stream).TakeRawData();
+
+    const size_t bytes = ticks.size() * sizeof(serialization::perf_tick_record);
+
+    const double mb_per_s = measure_mb_per_s(
+        bytes,
+        [&]()
+        {
+            serialization::multi_process_stream source;
+            source.SetRawData(buffer);
+            std::vector<serialization::perf_tick_record> loaded;
+            serialization::load(source, loaded);
+        });
+    check_throughput("BinaryLoadTickRecords", mb_per_s);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PerformanceRegressionTest, BinarySavePositions)
+{
+    std::vector<serialization::perf_position> positions(100000);
+    size_t payload_bytes = 0;
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        positions[i].symbol   = "SYM" + std::to_string(i % 512);
+        positions[i].quantity = static_cast<double>(i);
+        payload_bytes += positions[i].symbol.size() + sizeof(double);
+    }
+
+    const double mb_per_s = measure_mb_per_s(
+        payload_bytes,
+        [&]()
+        {
+            serialization::multi_process_stream stream;
+            serialization::save(stream, positions);
+        });
+    check_throughput("BinarySavePositions", mb_per_s);
+}
+
+//----------------------------------------------------------------------------
+TEST_F(PerformanceRegressionTest, BinaryLoadPositions)
+{
+    std::vector<serialization::perf_position> positions(100000);
+    size_t payload_bytes = 0;
+    for (size_t i = 0; i < positions.size(); ++i)
+    {
+        positions[i].symbol   = "SYM" + std::to_string(i % 512);
+        positions[i].quantity = static_cast<double>(i);
+        payload_bytes += positions[i].symbol.size() + sizeof(double);
+    }
+
+    serialization::multi_process_stream stream;
+    serialization::save(stream, positions);
+    auto buffer = std::move(stream).TakeRawData();
+
+    const double mb_per_s = measure_mb_per_s(
+        payload_bytes,
+        [&]()
+        {
+            serialization::multi_process_stream source;
+            source.SetRawData(buffer);
+            std::vector<serialization::perf_position> loaded;
+            serialization::load(source, loaded);
+        });
+    check_throughput("BinaryLoadPositions", mb_per_s);
+}
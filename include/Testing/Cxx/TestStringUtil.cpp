@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "util/string_util.h"
+
+//=============================================================================
+// Test Types
+//=============================================================================
+
+namespace
+{
+// Deliberately includes a negative enumerator so both the lookup table
+// and the numeric fallback are exercised below zero.
+enum class day_count : int
+{
+    none       = -1,
+    act_360    = 0,
+    act_365    = 1,
+    thirty_360 = 2
+};
+
+constexpr std::array<std::pair<day_count, std::string_view>, 4> day_count_entries{{
+    {day_count::none, "None"},
+    {day_count::act_360, "Act360"},
+    {day_count::act_365, "Act365"},
+    {day_count::thirty_360, "Thirty360"},
+}};
+
+using day_count_lookup = serialization::detail::enum_lookup<day_count, day_count_entries>;
+}  // namespace
+
+//=============================================================================
+// Test Fixture
+//=============================================================================
+
+class StringUtilTest : public ::testing::Test
+{
+};
+
+//=============================================================================
+// Test Cases
+//=============================================================================
+
+//----------------------------------------------------------------------------
+TEST_F(StringUtilTest, EnumLookupFindsEveryEntry)
+{
+    for (const auto& [value, name] : day_count_entries)
+    {
+        const auto found = day_count_lookup::find(name);
+        ASSERT_TRUE(found.has_value()) << name;
+        EXPECT_EQ(value, *found) << name;
+    }
+}
+
+//----------------------------------------------------------------------------
+TEST_F(StringUtilTest, EnumLookupIsCaseInsensitive)
+{
+    EXPECT_EQ(day_count::act_360, day_count_lookup::find("act360"));
+    EXPECT_EQ(day_count::act_365, day_count_lookup::find("ACT365"));
+    EXPECT_EQ(day_count::thirty_360, day_count_lookup::find("tHiRtY360"));
+    EXPECT_EQ(day_count::none, day_count_lookup::find("NONE"));
+}
+
+//----------------------------------------------------------------------------
+TEST_F(StringUtilTest, EnumLookupMissReturnsNullopt)
+{
+    EXPECT_EQ(std::nullopt, day_count_lookup::find(""));
+    EXPECT_EQ(std::nullopt, day_count_lookup::find("Act30360"));
+    EXPECT_EQ(std::nullopt, day_count_lookup::find("Act360 "));
+    EXPECT_EQ(std::nullopt, day_count_lookup::find("Act"));
+}
+
+//----------------------------------------------------------------------------
+TEST_F(StringUtilTest, EnumLookupIsUsableAtCompileTime)
+{
+    static_assert(day_count_lookup::find("Act365") == day_count::act_365);
+    static_assert(day_count_lookup::find("act365") == day_count::act_365);
+    static_assert(!day_count_lookup::find("Act366").has_value());
+    SUCCEED();
+}
+
+#if !SERIALIZATION_HAS_MAGICENUM
+
+//----------------------------------------------------------------------------
+// The numeric fallback used when magic_enum is unavailable: values round
+// trip through their underlying-type decimal representation.
+TEST_F(StringUtilTest, NumericFallbackRoundTrip)
+{
+    EXPECT_EQ("0", std::string(serialization::enum_to_string(day_count::act_360)));
+    EXPECT_EQ("2", std::string(serialization::enum_to_string(day_count::thirty_360)));
+
+    EXPECT_EQ(day_count::act_365, serialization::string_to_enum<day_count>("1"));
+    EXPECT_EQ(day_count::thirty_360, serialization::string_to_enum<day_count>("2"));
+}
+
+//----------------------------------------------------------------------------
+TEST_F(StringUtilTest, NumericFallbackHandlesNegativeValues)
+{
+    const auto text = std::string(serialization::enum_to_string(day_count::none));
+    EXPECT_EQ("-1", text);
+    EXPECT_EQ(day_count::none, serialization::string_to_enum<day_count>(text));
+}
+
+//----------------------------------------------------------------------------
+TEST_F(StringUtilTest, NumericFallbackRejectsMalformedInput)
+{
+    EXPECT_THROW(serialization::string_to_enum<day_count>(""), std::invalid_argument);
+    EXPECT_THROW(serialization::string_to_enum<day_count>("Act360"), std::invalid_argument);
+    EXPECT_THROW(serialization::string_to_enum<day_count>("1x"), std::invalid_argument);
+    EXPECT_THROW(serialization::string_to_enum<day_count>(" 1"), std::invalid_argument);
+}
+
+#endif  // !SERIALIZATION_HAS_MAGICENUM
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <filesystem>
 #include <map>
 #include <set>
 #include <string>
@@ -84,6 +85,46 @@ TEST_F(XmlSerializationTest, StringSerialization)
     EXPECT_EQ(a_in, a_out);
 }
 
+TEST_F(XmlSerializationTest, FloatTextShortestRoundTrip)
+{
+    // Shortest-representation formatting: the text carries exactly the
+    // digits needed, and loading restores the same bits.
+    const std::vector<double> values = {
+        0.1, 1.0 / 3.0, 3.141592653589793, 1e-300, 1.7976931348623157e308, -2.5e-7};
+    for (const double rhs : values)
+    {
+        doc.reset();
+        buffer = doc.append_child("test");
+        double lhs = 0;
+        serialization::save(buffer, rhs);
+        serialization::load(buffer, lhs);
+        EXPECT_EQ(rhs, lhs);
+    }
+
+    doc.reset();
+    buffer = doc.append_child("test");
+    serialization::save(buffer, 0.1);
+    EXPECT_STREQ("0.1", buffer.text().get());
+
+    // float goes through the same path and restores its exact bits.
+    doc.reset();
+    buffer = doc.append_child("test");
+    const float rhs_float = 0.1f;
+    float       lhs_float = 0;
+    serialization::save(buffer, rhs_float);
+    serialization::load(buffer, lhs_float);
+    EXPECT_EQ(rhs_float, lhs_float);
+
+    // Text written by the old snprintf path (fixed precision, leading
+    // plus) still parses.
+    doc.reset();
+    buffer = doc.append_child("test");
+    buffer.text().set("+3.14159265358979");
+    double legacy = 0;
+    serialization::load(buffer, legacy);
+    EXPECT_DOUBLE_EQ(3.14159265358979, legacy);
+}
+
 TEST_F(XmlSerializationTest, PairSerialization)
 {
     std::pair<float, float> a_in = std::make_pair(1.0f, 1.0f);
@@ -106,6 +147,129 @@ TEST_F(XmlSerializationTest, VectorSerialization)
     EXPECT_EQ(rhs, lhs);
 }
 
+TEST_F(XmlSerializationTest, StreamedEmitterParsesBackThroughDom)
+{
+    serialization::ptr_const<test::test_derived_serialization> rhs =
+        std::make_shared<test::test_derived_serialization>(6.7, "streamed");
+
+    const std::string text =
+        serialization::serialization_impl::access::xml_serialize_streamed(rhs);
+
+    pugi::xml_document doc;
+    ASSERT_TRUE(doc.load_string(text.c_str()));
+    auto root = doc.child("root");
+
+    serialization::ptr_const<test::test_serialization> lhs;
+    serialization::load(root, lhs);
+
+    auto lhs_derived = std::dynamic_pointer_cast<const test::test_derived_serialization>(lhs);
+    ASSERT_NE(lhs_derived, nullptr);
+    EXPECT_EQ(rhs->d(), lhs->d());
+    EXPECT_EQ("streamed", lhs_derived->n());
+}
+
+TEST_F(XmlSerializationTest, StreamedFileRoundTrip)
+{
+    const std::string path = "test_streamed_writer.xml";
+
+    serialization::ptr_const<test::test_derived_serialization> rhs =
+        std::make_shared<test::test_derived_serialization>(-1.25, "to disk");
+    serialization::serialization_impl::access::write_to_xml_streamed(path, rhs);
+
+    const auto lhs =
+        serialization::serialization_impl::access::read_from_xml<test::test_serialization>(path);
+    auto lhs_derived = std::dynamic_pointer_cast<const test::test_derived_serialization>(lhs);
+    ASSERT_NE(lhs_derived, nullptr);
+    EXPECT_EQ(rhs->d(), lhs->d());
+    EXPECT_EQ("to disk", lhs_derived->n());
+
+    std::filesystem::remove(path);
+}
+
+TEST_F(XmlSerializationTest, ParallelDeserializeMatchesSerialLoad)
+{
+    std::vector<serialization::ptr_const<test::test_serialization>> rhs;
+    for (int i = 0; i < 64; ++i)
+    {
+        rhs.push_back(std::make_shared<test::test_serialization>(i * 0.25));
+    }
+
+    pugi::xml_document doc;
+    auto               root = doc.append_child("root");
+    serialization::save(root, rhs);
+
+    const auto parallel = serialization::serialization_impl::access::xml_deserialize_parallel<
+        test::test_serialization>(doc, 4);
+    const auto serial = serialization::serialization_impl::access::xml_deserialize_parallel<
+        test::test_serialization>(doc, 1);
+
+    ASSERT_EQ(rhs.size(), parallel.size());
+    ASSERT_EQ(rhs.size(), serial.size());
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        EXPECT_EQ(rhs[i]->d(), parallel[i]->d());
+        EXPECT_EQ(rhs[i]->d(), serial[i]->d());
+    }
+}
+
+TEST_F(XmlSerializationTest, NestedContainerCursorRoundTrip)
+{
+    // Nested lists interleave indexed access across parents, exercising
+    // the traversal cursor's re-seed path as well as its sequential one.
+    std::vector<std::vector<int>> rhs(50);
+    for (size_t i = 0; i < rhs.size(); ++i)
+    {
+        rhs[i].resize(i % 7);
+        for (size_t j = 0; j < rhs[i].size(); ++j)
+        {
+            rhs[i][j] = static_cast<int>(i * 100 + j);
+        }
+    }
+
+    serialization::save(buffer, rhs);
+
+    std::vector<std::vector<int>> lhs;
+    serialization::load(buffer, lhs);
+    EXPECT_EQ(rhs, lhs);
+}
+
+TEST_F(XmlSerializationTest, ExternalDocumentSizeIsCached)
+{
+    // External documents carry no Size attribute, so size() falls back
+    // to counting children; the count is cached after the first walk.
+    pugi::xml_document external;
+    ASSERT_TRUE(external.load_string(
+        "<values><item>7</item><item>11</item><item>13</item></values>"));
+    pugi::xml_node root = external.child("values");
+
+    std::vector<int> lhs;
+    serialization::load(root, lhs);
+    EXPECT_EQ((std::vector<int>{7, 11, 13}), lhs);
+
+    // A second load of the same node consults the cached count.
+    std::vector<int> again;
+    serialization::load(root, again);
+    EXPECT_EQ(lhs, again);
+}
+
+TEST_F(XmlSerializationTest, PackedNumericContainerRoundTrip)
+{
+    std::vector<double> rhs = {0.125, -7.5, 1e9, 3.14159};
+
+    {
+        serialization::packed_numeric_scope scope;
+        serialization::save(buffer, rhs);
+    }
+    // The node carries the blob as text instead of one child per element.
+    ASSERT_TRUE(buffer.attribute("Packed"));
+    EXPECT_EQ(4U, buffer.attribute("Size").as_uint());
+    EXPECT_FALSE(buffer.first_child().first_child());
+
+    std::vector<double> lhs;
+    serialization::load(buffer, lhs);
+    EXPECT_EQ(rhs, lhs);
+}
+
 TEST_F(XmlSerializationTest, SetSerialization)
 {
     std::set<int> rhs{1, 2, 3, 4, 5};
@@ -208,6 +372,50 @@ TEST_F(XmlSerializationTest, VariantSerialization)
     EXPECT_EQ(rhs, lhs);
 }
 
+//=============================================================================
+// Arena-Backed Document Tests
+//=============================================================================
+
+TEST_F(XmlSerializationTest, ArenaBackedDocumentRoundTrip)
+{
+    const std::string path = "test_arena_nodes.xml";
+
+    serialization::ptr_const<test::test_derived_serialization> rhs =
+        std::make_shared<test::test_derived_serialization>(3.5, "arena");
+    serialization::serialization_impl::access::write_to_xml(path, rhs);
+
+    // Facade path: node memory for the parse comes from an arena that is
+    // released wholesale when the call returns.
+    const auto lhs =
+        serialization::serialization_impl::access::read_from_xml<test::test_serialization>(
+            path, true);
+    auto lhs_derived = std::dynamic_pointer_cast<const test::test_derived_serialization>(lhs);
+    ASSERT_NE(lhs_derived, nullptr);
+    EXPECT_EQ(rhs->d(), lhs->d());
+    EXPECT_EQ("arena", lhs_derived->n());
+
+    // Explicit scope: the arena is declared before the document so the
+    // document is destroyed first, and parsing draws from its pages.
+    {
+        serialization::xml_document_arena arena;
+        pugi::xml_document                arena_doc;
+        serialization::serialization_impl::access::read_xml(path, arena_doc);
+        EXPECT_GT(arena.allocated_bytes(), 0U);
+
+        serialization::ptr_const<test::test_serialization> again;
+        serialization::serialization_impl::access::xml_deserialize(arena_doc, again);
+        ASSERT_NE(again, nullptr);
+        EXPECT_EQ(rhs->d(), again->d());
+    }
+
+    // Heap-backed documents keep working once the hooks are installed.
+    pugi::xml_document heap_doc;
+    serialization::serialization_impl::access::read_xml(path, heap_doc);
+    EXPECT_FALSE(heap_doc.empty());
+
+    std::filesystem::remove(path);
+}
+
 //=============================================================================
 // FpML XML File Round-Trip Test
 //=============================================================================
@@ -0,0 +1,154 @@
+#include "support/allocation_tracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//=============================================================================
+// Counters
+//=============================================================================
+
+namespace
+{
+std::atomic<uint64_t> g_allocations{0};
+std::atomic<uint64_t> g_deallocations{0};
+std::atomic<uint64_t> g_bytes{0};
+
+//----------------------------------------------------------------------------
+void* counted_allocate(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size);
+}
+
+//----------------------------------------------------------------------------
+void* counted_allocate(std::size_t size, std::align_val_t alignment)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+    // aligned_alloc requires the size to be a multiple of the alignment.
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    const std::size_t rounded = (size + align - 1) / align * align;
+    return std::aligned_alloc(align, rounded);
+}
+
+//----------------------------------------------------------------------------
+void counted_free(void* pointer)
+{
+    if (pointer != nullptr)
+    {
+        g_deallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::free(pointer);
+}
+}  // namespace
+
+namespace serialization
+{
+namespace testing
+{
+//----------------------------------------------------------------------------
+allocation_counts current_allocation_counts()
+{
+    return {
+        g_allocations.load(std::memory_order_relaxed),
+        g_deallocations.load(std::memory_order_relaxed),
+        g_bytes.load(std::memory_order_relaxed)};
+}
+}  // namespace testing
+}  // namespace serialization
+
+//=============================================================================
+// Global operator new/delete replacements
+//=============================================================================
+
+void* operator new(std::size_t size)
+{
+    void* pointer = counted_allocate(size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* pointer = counted_allocate(size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    void* pointer = counted_allocate(size, alignment);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    void* pointer = counted_allocate(size, alignment);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    counted_free(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    counted_free(pointer);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * Test-support allocation interceptor.
+ *
+ * Linking the accompanying translation unit into a test executable
+ * replaces the global operator new/delete with counting versions, so
+ * tests can assert allocation budgets on library operations:
+ *
+ *     serialization::testing::allocation_scope scope;
+ *     ... operation under test ...
+ *     EXPECT_LE(scope.allocations(), budget);
+ *
+ * Counters are process-wide relaxed atomics; the hooks never allocate
+ * themselves. Test-only: the library proper is never linked against
+ * this.
+ */
+
+#include <cstdint>
+
+namespace serialization
+{
+namespace testing
+{
+struct allocation_counts
+{
+    uint64_t allocations{0};
+    uint64_t deallocations{0};
+    uint64_t bytes{0};
+};
+
+/** @brief Totals since process start. */
+allocation_counts current_allocation_counts();
+
+/**
+ * @brief Snapshots the counters on construction and reports the deltas
+ *        accumulated while alive.
+ */
+class allocation_scope
+{
+public:
+    allocation_scope() : start_(current_allocation_counts()) {}
+
+    uint64_t allocations() const
+    {
+        return current_allocation_counts().allocations - start_.allocations;
+    }
+
+    uint64_t bytes() const { return current_allocation_counts().bytes - start_.bytes; }
+
+private:
+    allocation_counts start_;
+};
+}  // namespace testing
+}  // namespace serialization
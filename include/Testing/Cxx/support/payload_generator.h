@@ -0,0 +1,315 @@
+#pragma once
+
+/**
+ * Seeded synthetic payload generator for benchmarks and stress tests.
+ *
+ * Fabricates object graphs against any reflectable type by walking the
+ * same member tuple the serializers use, so anything the library can
+ * serialize can be generated. Shape is controlled by payload_config:
+ * container size and string length ranges, optional fill density,
+ * pointer density and depth, and a weighted polymorphism mix per base
+ * type via register_derived. Generation is fully deterministic for a
+ * given seed and config, so failing inputs reproduce from one integer.
+ *
+ *     serialization::testing::payload_generator generator({.seed = 42});
+ *     auto portfolio = generator.generate<my_portfolio>();
+ */
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <typeindex>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "common/reflection.h"
+#include "common/serialization_concepts.h"
+#include "serialization_impl.h"
+
+namespace serialization
+{
+namespace testing
+{
+/**
+ * @brief Knobs controlling the shape of generated graphs.
+ */
+struct payload_config
+{
+    uint64_t seed = 1;
+
+    /** Inclusive element-count range for resizable containers. */
+    size_t min_container_size = 0;
+    size_t max_container_size = 16;
+
+    /** Inclusive length range for generated strings. */
+    size_t min_string_length = 0;
+    size_t max_string_length = 24;
+
+    /** Probability an optional member holds a value. */
+    double optional_density = 0.5;
+
+    /** Probability a pointer member is non-null (within the depth cap). */
+    double pointer_density = 0.75;
+
+    /** Pointer chains stop once the graph is this deep. */
+    size_t max_depth = 8;
+};
+
+class payload_generator
+{
+public:
+    explicit payload_generator(payload_config config = {})
+        : config_(config), rng_(config.seed)
+    {
+    }
+
+    /**
+     * @brief Adds @a Derived to the mix generated for pointers to
+     *        @a Base, with the given relative weight (the base itself
+     *        keeps weight 1).
+     */
+    template <typename Base, typename Derived>
+    void register_derived(double weight = 1.0)
+    {
+        static_assert(std::is_base_of_v<Base, Derived>);
+        derived_mix_[std::type_index(typeid(Base))].push_back(
+            {weight,
+             [](payload_generator& generator, size_t depth) -> std::shared_ptr<void>
+             {
+                 std::shared_ptr<Derived> object(
+                     serialization::access::serializer::make_ptr<Derived>().release());
+                 generator.fill(*object, depth);
+                 return object;
+             }});
+    }
+
+    /** @brief Builds one fully populated value of @a T. */
+    template <typename T>
+    T generate()
+    {
+        if constexpr (std::is_default_constructible_v<T>)
+        {
+            T value{};
+            fill(value, 0);
+            return value;
+        }
+        else
+        {
+            auto value = serialization::access::serializer::make_ptr<T>();
+            fill(*value, 0);
+            return std::move(*value);
+        }
+    }
+
+    /** @brief Populates @a value in place; @a depth guards recursion. */
+    template <typename T>
+    void fill(T& value, size_t depth)
+    {
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            value = chance(0.5);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            value = static_cast<T>(next_index(0, 3));
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            value = static_cast<T>(rng_());
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            value = static_cast<T>(std::uniform_real_distribution<double>(-1e6, 1e6)(rng_));
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            const size_t length =
+                next_index(config_.min_string_length, config_.max_string_length);
+            value.resize(length);
+            for (auto& character : value)
+            {
+                character = static_cast<char>('a' + next_index(0, 25));
+            }
+        }
+        else if constexpr (OptionalLike<T>)
+        {
+            if (chance(config_.optional_density))
+            {
+                typename T::value_type element{};
+                fill(element, depth);
+                value = std::move(element);
+            }
+            else
+            {
+                value.reset();
+            }
+        }
+        else if constexpr (SmartPointer<T>)
+        {
+            fill_pointer(value, depth);
+        }
+        else if constexpr (MapLike<T>)
+        {
+            value.clear();
+            const size_t count =
+                next_index(config_.min_container_size, config_.max_container_size);
+            for (size_t i = 0; i < count; ++i)
+            {
+                typename T::key_type key{};
+                fill(key, depth);
+                typename T::mapped_type mapped{};
+                fill(mapped, depth);
+                value.emplace(std::move(key), std::move(mapped));
+            }
+        }
+        else if constexpr (SetLike<T>)
+        {
+            value.clear();
+            const size_t count =
+                next_index(config_.min_container_size, config_.max_container_size);
+            for (size_t i = 0; i < count; ++i)
+            {
+                typename T::key_type key{};
+                fill(key, depth);
+                value.emplace(std::move(key));
+            }
+        }
+        else if constexpr (EmplaceBackable<T>)
+        {
+            value.clear();
+            const size_t count =
+                next_index(config_.min_container_size, config_.max_container_size);
+            for (size_t i = 0; i < count; ++i)
+            {
+                value.emplace_back();
+                fill(value.back(), depth);
+            }
+        }
+        else if constexpr (VariantLike<T>)
+        {
+            fill_variant(value, depth);
+        }
+        else if constexpr (TupleLike<T>)
+        {
+            std::apply([&](auto&... elements) { (fill(elements, depth), ...); }, value);
+        }
+        else if constexpr (Reflectable<T>)
+        {
+            constexpr auto count =
+                std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+            for_sequence(
+                std::make_index_sequence<count>{},
+                [&]<auto I>(std::integral_constant<std::size_t, I>)
+                {
+                    constexpr auto property =
+                        std::get<I>(serialization::access::serializer::tuple<T>());
+                    if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+                    {
+                        fill(value.*(property.member()), depth);
+                    }
+                });
+        }
+        else
+        {
+            // Unmodelled scalar-ish types keep their default value.
+        }
+    }
+
+private:
+    struct derived_entry
+    {
+        double weight{1.0};
+        std::shared_ptr<void> (*make)(payload_generator&, size_t){nullptr};
+    };
+
+    //------------------------------------------------------------------------
+    template <typename T>
+    void fill_pointer(T& pointer, size_t depth)
+    {
+        using element_type = typename T::element_type;
+
+        if (depth >= config_.max_depth || !chance(config_.pointer_density))
+        {
+            pointer = nullptr;
+            return;
+        }
+
+        // Weighted polymorphism mix: the base competes with every
+        // registered derived type at weight 1.
+        if constexpr (SharedPointer<T> && std::is_polymorphic_v<element_type>)
+        {
+            const auto it = derived_mix_.find(std::type_index(typeid(element_type)));
+            if (it != derived_mix_.end())
+            {
+                double total = 1.0;
+                for (const auto& entry : it->second)
+                {
+                    total += entry.weight;
+                }
+                double pick = std::uniform_real_distribution<double>(0.0, total)(rng_);
+                for (const auto& entry : it->second)
+                {
+                    pick -= entry.weight;
+                    if (pick < 0.0)
+                    {
+                        pointer = std::static_pointer_cast<element_type>(
+                            entry.make(*this, depth + 1));
+                        return;
+                    }
+                }
+                // Fell through the weights: generate the base itself.
+            }
+        }
+
+        std::unique_ptr<element_type> object(
+            serialization::access::serializer::make_ptr<element_type>().release());
+        fill(*object, depth + 1);
+        pointer = T(object.release());
+    }
+
+    //------------------------------------------------------------------------
+    template <typename... Types>
+    void fill_variant(std::variant<Types...>& value, size_t depth)
+    {
+        const size_t target = next_index(0, sizeof...(Types) - 1);
+        [&]<size_t... Is>(std::index_sequence<Is...>)
+        {
+            (
+                [&]
+                {
+                    if (target != Is)
+                    {
+                        return;
+                    }
+                    using alternative = std::variant_alternative_t<Is, std::variant<Types...>>;
+                    if constexpr (std::is_default_constructible_v<alternative>)
+                    {
+                        value.template emplace<Is>();
+                        fill(std::get<Is>(value), depth);
+                    }
+                }(),
+                ...);
+        }(std::make_index_sequence<sizeof...(Types)>{});
+    }
+
+    //------------------------------------------------------------------------
+    size_t next_index(size_t low, size_t high)
+    {
+        return std::uniform_int_distribution<size_t>(low, high)(rng_);
+    }
+
+    bool chance(double probability)
+    {
+        return std::uniform_real_distribution<double>(0.0, 1.0)(rng_) < probability;
+    }
+
+    payload_config                                       config_;
+    std::mt19937_64                                      rng_;
+    std::map<std::type_index, std::vector<derived_entry>> derived_mix_;
+};
+}  // namespace testing
+}  // namespace serialization
@@ -15,10 +15,15 @@ limitations under the License.
 
 #pragma once
 
+#include <charconv>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <typeinfo>
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <nlohmann/json.hpp>
 #include <pugixml.hpp>
 #include <stdexcept>
@@ -27,8 +32,12 @@ limitations under the License.
 #include <type_traits>
 #include <variant>
 
+#include "common/json_emitter.h"
+#include "common/reflection.h"
+#include "common/xml_emitter.h"
 #include "common/serialization_type_traits.h"
 #include "util/export.h"
+#include "util/flat_hash.h"
 #include "util/multi_process_stream.h"
 #include "util/registry.h"
 #include "util/string_util.h"
@@ -56,25 +65,29 @@ using xml = pugi::xml_node;
 //=============================================================================
 // Note: These type aliases define the function signatures for serialization
 // callbacks used in the registry pattern for polymorphic type handling.
+// Every registered callback is a register_serializer_impl instantiation —
+// a stateless free function — so the registries hold plain function
+// pointers: dispatch is one indirect call with no std::function wrapper,
+// and registration never heap-allocates.
 
 /// @brief Function type for JSON serialization callbacks
 /// @param archive The JSON object to serialize to/from
 /// @param obj Pointer to the object being serialized
 /// @param is_saving True if saving, false if loading
-using json_serialization_function_t = std::function<void(json&, void*, bool)>;
+using json_serialization_function_t = void (*)(json&, void*, bool);
 
 /// @brief Function type for XML serialization callbacks
 /// @param archive The XML node to serialize to/from
 /// @param obj Pointer to the object being serialized
 /// @param is_saving True if saving, false if loading
-using xml_serialization_function_t = std::function<void(pugi::xml_node&, void*, bool)>;
+using xml_serialization_function_t = void (*)(pugi::xml_node&, void*, bool);
 
 /// @brief Function type for binary serialization callbacks
 /// @param archive The binary stream to serialize to/from
 /// @param obj Pointer to the object being serialized
 /// @param is_saving True if saving, false if loading
 using binary_serialization_function_t =
-    std::function<void(serialization::multi_process_stream&, void*, bool)>;
+    void (*)(serialization::multi_process_stream&, void*, bool);
 
 SERIALIZATION_API SERIALIZATION_DECLARE_FUNCTION_REGISTRY(
     JsonSerializationRegistry, json_serialization_function_t);
@@ -101,6 +114,44 @@ class archiver_wrapper
 // Enum Serialization Helpers
 //=============================================================================
 
+/**
+ * @brief Opt-in dictionary-encoded enum mode for JSON saves.
+ *
+ * While a scope is active on the thread, enum fields serialize as their
+ * small underlying integers instead of repeated name strings, and every
+ * distinct value encountered is recorded once in the supplied dictionary
+ * (enum type name -> { value name : integer }). Embedding the dictionary
+ * next to the payload keeps the archive self-describing while a
+ * million-row export stops repeating "AnnualCompounding" a million
+ * times. Loading needs no mode: the integers reconstruct through the
+ * existing from_json integer branch.
+ */
+class enum_dictionary_scope
+{
+public:
+    explicit enum_dictionary_scope(json& dictionary) : previous_(active())
+    {
+        active() = &dictionary;
+    }
+
+    ~enum_dictionary_scope() { active() = previous_; }
+
+    enum_dictionary_scope(const enum_dictionary_scope&)            = delete;
+    enum_dictionary_scope& operator=(const enum_dictionary_scope&) = delete;
+
+    /// @brief The dictionary installed on this thread, if any.
+    [[nodiscard]] static json* current() { return active(); }
+
+private:
+    static json*& active()
+    {
+        static thread_local json* pointer = nullptr;
+        return pointer;
+    }
+
+    json* previous_;
+};
+
 /// @brief Convert enum to JSON representation
 /// @tparam EnumType Must be an enum type
 /// @param archive The JSON object to write to
@@ -109,6 +160,15 @@ template <typename EnumType>
     requires std::is_enum_v<EnumType>
 void to_json(json& archive, const EnumType& e)
 {
+    if (json* dictionary = enum_dictionary_scope::current(); dictionary != nullptr)
+    {
+        const auto value =
+            static_cast<int64_t>(static_cast<std::underlying_type_t<EnumType>>(e));
+        (*dictionary)[demangled_name(typeid(EnumType))][std::string(enum_to_string(e))] =
+            value;
+        archive = value;
+        return;
+    }
     archive = std::string(enum_to_string(e));
 }
 
@@ -141,6 +201,54 @@ inline constexpr std::string_view CLASS_NAME{R"(Class)"};
 /// @brief JSON field name for container size information
 inline constexpr std::string_view SIZE_NAME{R"(Size)"};
 
+/// @brief JSON field name for the columnar (struct-of-arrays) layout
+inline constexpr std::string_view COLUMNS_NAME{R"(Columns)"};
+
+/// @brief Field name for the packed (base64) numeric container encoding
+inline constexpr std::string_view PACKED_NAME{R"(Packed)"};
+
+/// @brief JSON field name for the sidecar enum-value dictionary
+inline constexpr std::string_view ENUM_DICTIONARY_NAME{R"(EnumDictionary)"};
+
+/// @brief Pre-hashed handles for the fixed archive field names
+inline constexpr field_name CLASS_FIELD{CLASS_NAME};
+inline constexpr field_name SIZE_FIELD{SIZE_NAME};
+
+//=============================================================================
+// Key Interning
+//=============================================================================
+
+/// @brief Returns a cached std::string holding @a key.
+/// nlohmann::ordered_json::operator[] has no transparent string_view
+/// overload, so every field access used to construct a fresh
+/// std::string — one heap allocation per field per object. Reflection
+/// field names are a small fixed set, so each unique key is materialized
+/// once per thread and reused; deque storage keeps the cached strings
+/// (and the views keying them) stable across growth. Accepts either a
+/// plain string_view or a pre-hashed field_name handle; the handle skips
+/// re-hashing the key bytes on lookup.
+[[nodiscard]] inline const std::string& interned_key(const field_name& key)
+{
+    static thread_local std::deque<std::string>                              storage;
+    static thread_local quarisma::quarisma_map<std::string_view, const std::string*> cache;
+
+    const auto it = cache.find(key);
+    if (it != cache.end()) [[likely]]
+    {
+        return *it->second;
+    }
+
+    storage.emplace_back(key.name);
+    const std::string& owned = storage.back();
+    cache.emplace(std::string_view{owned}, &owned);
+    return owned;
+}
+
+[[nodiscard]] inline const std::string& interned_key(std::string_view key)
+{
+    return interned_key(field_name{key});
+}
+
 //=============================================================================
 // JSON Archiver Specialization
 //=============================================================================
@@ -239,7 +347,7 @@ struct archiver_wrapper<json>
     /// @param name The class name to store
     static void push_class_name(json& archive, const std::string& name)
     {
-        archive[std::string(CLASS_NAME)] = name;
+        archive[interned_key(CLASS_FIELD)] = name;
     }
 
     /// @brief Retrieve class type information from JSON
@@ -247,13 +355,13 @@ struct archiver_wrapper<json>
     /// @return The stored class name, or empty string if not found
     [[nodiscard]] static auto pop_class_name(json& archive)
     {
-        if (!archive.contains(std::string(CLASS_NAME)))
+        if (!archive.contains(interned_key(CLASS_FIELD)))
         {
             SERIALIZATION_LOG_WARNING("json does not have a class name field!");
             return std::string();
         }
 
-        const auto& name = archive[std::string(CLASS_NAME)];
+        const auto& name = archive[interned_key(CLASS_FIELD)];
         if (name.is_string())
         {
             return name.get<std::string>();
@@ -269,7 +377,7 @@ struct archiver_wrapper<json>
     /// @param idx The index value to store
     static void push_index(json& archive, std::string_view index_name, unsigned int idx)
     {
-        archive[std::string(index_name)] = idx;
+        archive[interned_key(index_name)] = idx;
     }
 
     /// @brief Retrieve container index from JSON
@@ -278,7 +386,7 @@ struct archiver_wrapper<json>
     /// @return The stored index value
     [[nodiscard]] static auto pop_index(json& archive, std::string_view index_name)
     {
-        return archive[std::string(index_name)].get<unsigned int>();
+        return archive[interned_key(index_name)].get<unsigned int>();
     }
 
     /// @brief Get JSON element by string key (const)
@@ -287,7 +395,16 @@ struct archiver_wrapper<json>
     /// @return Const reference to the JSON element
     [[nodiscard]] static const auto& get(const json& archive, std::string_view idx)
     {
-        return archive[std::string(idx)];
+        return archive[interned_key(idx)];
+    }
+
+    /// @brief Get JSON element by pre-hashed field handle (const)
+    /// @param archive The JSON object to read from
+    /// @param idx The field handle to access
+    /// @return Const reference to the JSON element
+    [[nodiscard]] static const auto& get(const json& archive, const field_name& idx)
+    {
+        return archive[interned_key(idx)];
     }
 
     /// @brief Get JSON element by numeric index (const)
@@ -300,7 +417,13 @@ struct archiver_wrapper<json>
     /// @param archive The JSON object to modify
     /// @param idx The key to access
     /// @return Mutable reference to the JSON element
-    static auto& get(json& archive, std::string_view idx) { return archive[std::string(idx)]; }
+    static auto& get(json& archive, std::string_view idx) { return archive[interned_key(idx)]; }
+
+    /// @brief Get JSON element by pre-hashed field handle (mutable)
+    /// @param archive The JSON object to modify
+    /// @param idx The field handle to access
+    /// @return Mutable reference to the JSON element
+    static auto& get(json& archive, const field_name& idx) { return archive[interned_key(idx)]; }
 
     /// @brief Get JSON element by numeric index (mutable)
     /// @param archive The JSON object to modify
@@ -349,6 +472,46 @@ struct xml_node_wrapper
     const pugi::xml_node* operator->() const { return &node; }
 };
 
+//=============================================================================
+// Floating-Point Text Formatting
+//=============================================================================
+
+/// @brief Writes @a value as @a archive's text in the shortest form that
+/// round-trips to the same bits.
+/// pugi::xml_text::set(double) formats through snprintf at a fixed
+/// precision, which both drops mantissa bits (curve values no longer
+/// compare equal after a save/load) and costs more than to_chars'
+/// shortest-representation algorithm.
+inline void set_float_text(pugi::xml_node& archive, double value)
+{
+    char       buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    *result.ptr       = '\0';
+    archive.text().set(static_cast<const char*>(buffer));
+}
+
+/// @brief Reads a floating-point value back with from_chars.
+/// The general format covers everything set_float_text emits plus the
+/// fixed/scientific text of archives written by the old snprintf path.
+/// from_chars does not eat leading whitespace or an explicit plus sign
+/// the way strtod does, so those are skipped here; unparsable or absent
+/// text yields zero, matching as_double().
+template <typename Float>
+[[nodiscard]] inline Float get_float_text(const pugi::xml_node& archive)
+{
+    std::string_view text  = archive.text().get();
+    const size_t     begin = text.find_first_not_of(" \t\n\r");
+    if (begin == std::string_view::npos)
+    {
+        return Float{};
+    }
+    text.remove_prefix(begin + (text[begin] == '+' ? 1 : 0));
+
+    Float value{};
+    std::from_chars(text.data(), text.data() + text.size(), value);
+    return value;
+}
+
 //=============================================================================
 // XML Archiver Specialization
 //=============================================================================
@@ -368,7 +531,7 @@ struct archiver_wrapper<pugi::xml_node>
     {
         if constexpr (std::is_same_v<T, serialization::datetime>)
         {
-            archive.text().set(static_cast<double>(obj));
+            set_float_text(archive, static_cast<double>(obj));
         }
         else if constexpr (std::is_same_v<T, const char*>)
         {
@@ -411,7 +574,7 @@ struct archiver_wrapper<pugi::xml_node>
         }
         else if constexpr (std::is_floating_point_v<T>)
         {
-            archive.text().set(static_cast<double>(obj));
+            set_float_text(archive, static_cast<double>(obj));
         }
     }
 
@@ -425,7 +588,7 @@ struct archiver_wrapper<pugi::xml_node>
     {
         if constexpr (std::is_same_v<T, serialization::datetime>)
         {
-            obj = archive.text().as_double();
+            obj = get_float_text<double>(archive);
         }
         else if constexpr (std::is_same_v<T, const char*>)
         {
@@ -470,11 +633,11 @@ struct archiver_wrapper<pugi::xml_node>
         {
             if constexpr (std::is_same_v<T, float>)
             {
-                obj = archive.text().as_float();
+                obj = get_float_text<float>(archive);
             }
             else
             {
-                obj = static_cast<T>(archive.text().as_double());
+                obj = static_cast<T>(get_float_text<double>(archive));
             }
         }
     }
@@ -507,7 +670,7 @@ struct archiver_wrapper<pugi::xml_node>
     /// @param idx The index value to store
     static void push_index(pugi::xml_node& archive, std::string_view index_name, unsigned int idx)
     {
-        archive.append_attribute(std::string(index_name).c_str()).set_value(idx);
+        archive.append_attribute(interned_key(index_name).c_str()).set_value(idx);
     }
 
     /// @brief Retrieve container index from XML
@@ -516,7 +679,46 @@ struct archiver_wrapper<pugi::xml_node>
     /// @return The stored index value
     [[nodiscard]] static auto pop_index(pugi::xml_node& archive, std::string_view index_name)
     {
-        return archive.attribute(std::string(index_name).c_str()).as_uint();
+        return archive.attribute(interned_key(index_name).c_str()).as_uint();
+    }
+
+private:
+    /// @brief Traversal cursor for indexed child access
+    /// Remembers the last node handed out for a parent so sequential
+    /// indices advance incrementally instead of restarting the sibling
+    /// walk at first_child() on every call.
+    struct xml_child_cursor
+    {
+        size_t         index = 0;
+        pugi::xml_node node;
+    };
+
+    /// @brief Returns the per-thread cursor associated with @a archive
+    /// Entries are keyed by the parent's internal pointer and re-seeded
+    /// whenever index 0 is requested, so a container whose storage is
+    /// reused by a later document starts from a fresh walk.
+    [[nodiscard]] static xml_child_cursor& child_cursor(const pugi::xml_node& archive)
+    {
+        static thread_local quarisma::quarisma_map<const void*, xml_child_cursor> cursors;
+        if (cursors.size() > 4096)
+        {
+            cursors.clear();
+        }
+        return cursors[archive.internal_object()];
+    }
+
+    /// @brief Per-thread cache of counted child totals
+    /// Externally produced documents never carry our Size attribute, so
+    /// size() used to re-walk every child on each call; the count is
+    /// cached per node and dropped again when a child is appended.
+    [[nodiscard]] static quarisma::quarisma_map<const void*, size_t>& counted_sizes()
+    {
+        static thread_local quarisma::quarisma_map<const void*, size_t> sizes;
+        if (sizes.size() > 4096)
+        {
+            sizes.clear();
+        }
+        return sizes;
     }
 
 public:
@@ -526,21 +728,39 @@ public:
     /// @return The XML child node (by value to avoid aliasing issues with nested calls)
     [[nodiscard]] static pugi::xml_node get(const pugi::xml_node& archive, std::string_view idx)
     {
-        return archive.child(std::string(idx).c_str());
+        return archive.child(interned_key(idx).c_str());
+    }
+
+    /// @brief Get XML child node by pre-hashed field handle (const)
+    /// @param archive The XML node to read from
+    /// @param idx The field handle to access
+    /// @return The XML child node (by value to avoid aliasing issues with nested calls)
+    [[nodiscard]] static pugi::xml_node get(const pugi::xml_node& archive, const field_name& idx)
+    {
+        return archive.child(interned_key(idx).c_str());
     }
 
     /// @brief Get XML child node by numeric index (const)
     /// @param archive The XML node to read from
     /// @param idx The index to access
     /// @return The XML child node (by value to avoid aliasing issues with nested calls)
+    /// Container access is sequential, so the per-parent cursor advances
+    /// one sibling per call instead of re-walking from first_child() —
+    /// O(n) over a whole container instead of O(n^2).
     [[nodiscard]] static pugi::xml_node get(const pugi::xml_node& archive, size_t idx)
     {
-        auto child = archive.first_child();
-        for (size_t i = 0; i < idx && child; ++i)
+        auto& cursor = child_cursor(archive);
+        if (idx == 0 || !cursor.node || idx < cursor.index)
         {
-            child = child.next_sibling();
+            cursor.node  = archive.first_child();
+            cursor.index = 0;
         }
-        return child;
+        while (cursor.index < idx && cursor.node)
+        {
+            cursor.node = cursor.node.next_sibling();
+            ++cursor.index;
+        }
+        return cursor.node;
     }
 
     /// @brief Get XML child node by string key (mutable)
@@ -549,10 +769,20 @@ public:
     /// @return The XML child node (by value to avoid aliasing issues with nested calls)
     static pugi::xml_node get(pugi::xml_node& archive, std::string_view idx)
     {
-        auto child = archive.child(std::string(idx).c_str());
+        return get(archive, field_name{idx});
+    }
+
+    /// @brief Get XML child node by pre-hashed field handle (mutable)
+    /// @param archive The XML node to modify
+    /// @param idx The field handle to access
+    /// @return The XML child node (by value to avoid aliasing issues with nested calls)
+    static pugi::xml_node get(pugi::xml_node& archive, const field_name& idx)
+    {
+        const char* name  = interned_key(idx).c_str();
+        auto        child = archive.child(name);
         if (!child)
         {
-            child = archive.append_child(std::string(idx).c_str());
+            child = archive.append_child(name);
         }
         return child;
     }
@@ -563,23 +793,31 @@ public:
     /// @return The XML child node (by value to avoid aliasing issues with nested calls)
     static pugi::xml_node get(pugi::xml_node& archive, size_t idx)
     {
-        auto child = archive.first_child();
-        for (size_t i = 0; i < idx; ++i)
+        auto& cursor = child_cursor(archive);
+        if (idx == 0 || idx < cursor.index || (!cursor.node && cursor.index < idx))
+        {
+            cursor.node  = archive.first_child();
+            cursor.index = 0;
+        }
+        while (cursor.index < idx)
         {
-            if (!child)
+            if (cursor.node)
             {
-                child = archive.append_child("item");
+                cursor.node = cursor.node.next_sibling();
             }
             else
             {
-                child = child.next_sibling();
+                cursor.node = archive.append_child("item");
+                counted_sizes().erase(archive.internal_object());
             }
+            ++cursor.index;
         }
-        if (!child)
+        if (!cursor.node)
         {
-            child = archive.append_child("item");
+            cursor.node = archive.append_child("item");
+            counted_sizes().erase(archive.internal_object());
         }
-        return child;
+        return cursor.node;
     }
 
     /// @brief Resize XML container (prepare for array serialization)
@@ -588,7 +826,7 @@ public:
     static void resize(pugi::xml_node& archive, size_t size)
     {
         // Store size as attribute for later reference
-        archive.append_attribute(std::string(SIZE_NAME).c_str()).set_value(static_cast<unsigned int>(size));
+        archive.append_attribute(interned_key(SIZE_FIELD).c_str()).set_value(static_cast<unsigned int>(size));
     }
 
     /// @brief Get the size of an XML container
@@ -596,17 +834,24 @@ public:
     /// @return The number of child elements or stored size attribute
     [[nodiscard]] static auto size(const pugi::xml_node& archive)
     {
-        auto size_attr = archive.attribute(std::string(SIZE_NAME).c_str());
+        auto size_attr = archive.attribute(interned_key(SIZE_FIELD).c_str());
         if (size_attr)
         {
             return static_cast<size_t>(size_attr.as_uint());
         }
-        // Count child nodes
-        size_t count = 0;
-        for (auto child : archive.children())
+
+        // Count child nodes once and reuse the total on later calls.
+        auto&      sizes = counted_sizes();
+        const auto it    = sizes.find(archive.internal_object());
+        if (it != sizes.end())
         {
-            ++count;
+            return it->second;
         }
+
+        const auto children = archive.children();
+        const auto count =
+            static_cast<size_t>(std::distance(children.begin(), children.end()));
+        sizes.emplace(archive.internal_object(), count);
         return count;
     }
 
@@ -689,20 +934,22 @@ struct archiver_wrapper<serialization::multi_process_stream>
     /// @brief Store class type information in binary stream
     /// @param archive The binary stream to write to
     /// @param name The class name to store
+    /// Names are interned per archive: the first occurrence writes the
+    /// string, later occurrences write only its id.
     static void push_class_name(
         serialization::multi_process_stream& archive, const std::string& name)
     {
-        archive << name;
+        archive.PushClassName(name);
     }
 
     /// @brief Retrieve class type information from binary stream
     /// @param archive The binary stream to read from
-    /// @return The stored class name
-    [[nodiscard]] static auto pop_class_name(serialization::multi_process_stream& archive)
+    /// @return Reference to the stored class name in the archive's
+    /// interning table (no allocation per object)
+    [[nodiscard]] static const std::string& pop_class_name(
+        serialization::multi_process_stream& archive)
     {
-        std::string ret;
-        archive >> ret;
-        return ret;
+        return archive.PopClassName();
     }
 
     /// @brief Store container index in binary stream
@@ -781,4 +1028,246 @@ struct archiver_wrapper<serialization::multi_process_stream>
     [[nodiscard]] static auto registry() { return serialization::BinarySerializationRegistry(); }
 };
 
+//=============================================================================
+// Streaming JSON Emitter Archiver Specialization (save-only)
+//=============================================================================
+
+/// @brief Specialization of archiver_wrapper for the streaming JSON emitter
+/// Writes tokens directly to the output buffer as the object graph is
+/// walked; no DOM is built. Pop operations are intentionally absent, so
+/// using the emitter as a load archiver fails to compile.
+template <>
+struct archiver_wrapper<json_emitter>
+{
+    /// @brief Serialize a base-serializable type as a JSON token
+    /// @tparam T Must satisfy is_base_serializable concept
+    /// @param archive The emitter to write to
+    /// @param obj The object to serialize
+    template <typename T>
+        requires is_base_serializable<T>::value
+    static void push(json_emitter& archive, const T& obj)
+    {
+        if constexpr (std::is_same_v<T, serialization::datetime>)
+        {
+            archive.value(static_cast<double>(obj));
+        }
+        else if constexpr (std::is_same_v<T, const char*>)
+        {
+            if (obj == nullptr)
+            {
+                archive.value_null();
+            }
+            else
+            {
+                archive.value(std::string_view{obj});
+            }
+        }
+        else if constexpr (std::is_same_v<T, std::monostate>)
+        {
+            archive.value_null();
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            archive.value(enum_to_string(obj));
+        }
+        else if constexpr (
+            std::is_same_v<T, serialization::tenor> || std::is_same_v<T, serialization::key>)
+        {
+            archive.value(std::string_view{obj.to_string()});
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            archive.value(std::string_view{obj});
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            archive.value(obj);
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                archive.value(static_cast<long long>(obj));
+            }
+            else
+            {
+                archive.value(static_cast<unsigned long long>(obj));
+            }
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            archive.value(static_cast<double>(obj));
+        }
+    }
+
+    /// @brief Emit the class name member; the enclosing object token is
+    /// opened here and closed by serializer_impl once the members are out
+    /// @param archive The emitter to write to
+    /// @param name The class name to store
+    static void push_class_name(json_emitter& archive, const std::string& name)
+    {
+        archive.begin_object();
+        archive.key(CLASS_NAME);
+        archive.value(std::string_view{name});
+    }
+
+    /// @brief Emit a container index member
+    /// @param archive The emitter to write to
+    /// @param index_name The field name for the index
+    /// @param idx The index value to store
+    static void push_index(json_emitter& archive, std::string_view index_name, unsigned int idx)
+    {
+        archive.key(index_name);
+        archive.value(static_cast<unsigned long long>(idx));
+    }
+
+    /// @brief Emit the member key and hand the emitter back for the value
+    /// @param archive The emitter to write to
+    /// @param idx The member name
+    /// @return Reference to the emitter
+    static auto& get(json_emitter& archive, std::string_view idx)
+    {
+        archive.key(idx);
+        return archive;
+    }
+
+    /// @brief Array elements need no key; separators are emitted inline
+    /// @param archive The emitter to write to
+    /// @param idx Unused (for API compatibility with JSON archiver)
+    /// @return Reference to the emitter
+    static auto& get(json_emitter& archive, [[maybe_unused]] size_t idx) { return archive; }
+
+    /// @brief No-op; array brackets come from serializer_impl hooks
+    /// @param archive The emitter (unused)
+    /// @param size The desired size (unused)
+    static void resize([[maybe_unused]] json_emitter& archive, [[maybe_unused]] size_t size) {}
+
+    /// @brief Get the emitter serialization registry
+    /// @return Pointer to the global emitter serialization registry
+    [[nodiscard]] static auto registry() { return serialization::JsonEmitterSerializationRegistry(); }
+};
+
+//=============================================================================
+// Streaming XML Emitter Archiver Specialization (save-only)
+//=============================================================================
+
+/// @brief Specialization of archiver_wrapper for the streaming XML emitter
+/// Writes tags directly to the output buffer as the object graph is
+/// walked; no pugi document is built. Named and indexed get open an
+/// element; scalars close it in push, and serializer_impl closes the
+/// elements that hold objects and containers. Pop operations are
+/// intentionally absent, so using the emitter as a load archiver fails
+/// to compile.
+template <>
+struct archiver_wrapper<xml_emitter>
+{
+    /// @brief Serialize a base-serializable type as element text
+    /// @tparam T Must satisfy is_base_serializable concept
+    /// @param archive The emitter to write to
+    /// @param obj The object to serialize
+    /// Closes the element opened by the preceding get.
+    template <typename T>
+        requires is_base_serializable<T>::value
+    static void push(xml_emitter& archive, const T& obj)
+    {
+        if constexpr (std::is_same_v<T, serialization::datetime>)
+        {
+            archive.text(static_cast<double>(obj));
+        }
+        else if constexpr (std::is_same_v<T, const char*>)
+        {
+            if (obj != nullptr)
+            {
+                archive.text(std::string_view{obj});
+            }
+        }
+        else if constexpr (std::is_same_v<T, std::monostate>)
+        {
+            // monostate is represented as empty element
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            archive.text(enum_to_string(obj));
+        }
+        else if constexpr (
+            std::is_same_v<T, serialization::tenor> || std::is_same_v<T, serialization::key>)
+        {
+            archive.text(std::string_view{obj.to_string()});
+        }
+        else if constexpr (std::is_same_v<T, std::string>)
+        {
+            archive.text(std::string_view{obj});
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            archive.text(obj);
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                archive.text(static_cast<long long>(obj));
+            }
+            else
+            {
+                archive.text(static_cast<unsigned long long>(obj));
+            }
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            archive.text(static_cast<double>(obj));
+        }
+        archive.end_element();
+    }
+
+    /// @brief Emit the class attribute on the current element
+    /// @param archive The emitter to write to
+    /// @param name The class name to store
+    static void push_class_name(xml_emitter& archive, const std::string& name)
+    {
+        archive.attribute("class", name);
+    }
+
+    /// @brief Emit a container index attribute
+    /// @param archive The emitter to write to
+    /// @param index_name The attribute name for the index
+    /// @param idx The index value to store
+    static void push_index(xml_emitter& archive, std::string_view index_name, unsigned int idx)
+    {
+        archive.attribute(index_name, static_cast<unsigned long long>(idx));
+    }
+
+    /// @brief Open a named child element and hand the emitter back
+    /// @param archive The emitter to write to
+    /// @param idx The child element name
+    /// @return Reference to the emitter
+    static auto& get(xml_emitter& archive, std::string_view idx)
+    {
+        archive.begin_element(idx);
+        return archive;
+    }
+
+    /// @brief Open an indexed child element and hand the emitter back
+    /// @param archive The emitter to write to
+    /// @param idx Unused (for API compatibility with the DOM archiver)
+    /// @return Reference to the emitter
+    static auto& get(xml_emitter& archive, [[maybe_unused]] size_t idx)
+    {
+        archive.begin_element("item");
+        return archive;
+    }
+
+    /// @brief Emit the container size attribute
+    /// @param archive The emitter to write to
+    /// @param size The container size
+    static void resize(xml_emitter& archive, size_t size)
+    {
+        archive.attribute(SIZE_NAME, static_cast<unsigned long long>(size));
+    }
+
+    /// @brief Get the streaming XML emitter serialization registry
+    /// @return Pointer to the global streaming XML emitter registry
+    [[nodiscard]] static auto registry() { return serialization::XmlEmitterSerializationRegistry(); }
+};
+
 }  // namespace serialization
\ No newline at end of file
@@ -52,6 +52,14 @@ struct serializer
         return std::unique_ptr<T>(new T());
     }
 
+    // placement counterpart of make_ptr, used when the load pipeline
+    // targets a caller-provided memory resource
+    template <typename T>
+    inline static T* construct_at(void* storage)
+    {
+        return ::new (storage) T();
+    }
+
     // use in case the object default constructor is public
     template <typename T>
     inline static auto make_shard_ptr()
@@ -0,0 +1,223 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "common/json_emitter.h"
+
+#include <charconv>
+#include <cstdio>
+#include <utility>
+
+namespace serialization
+{
+SERIALIZATION_API SERIALIZATION_DEFINE_FUNCTION_REGISTRY(
+    JsonEmitterSerializationRegistry, emitter_serialization_function_t);
+
+//----------------------------------------------------------------------------
+json_emitter::json_emitter(std::function<void(const char*, size_t)> sink, size_t chunk_size)
+    : sink_(std::move(sink)), chunk_size_(chunk_size > 0 ? chunk_size : 65536)
+{
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::begin_object()
+{
+    value_prefix();
+    out_.push_back('{');
+    first_.push_back(true);
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::end_object()
+{
+    first_.pop_back();
+    out_.push_back('}');
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::begin_array()
+{
+    value_prefix();
+    out_.push_back('[');
+    first_.push_back(true);
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::end_array()
+{
+    first_.pop_back();
+    out_.push_back(']');
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::key(std::string_view name)
+{
+    if (!first_.empty())
+    {
+        if (!first_.back())
+        {
+            out_.push_back(',');
+        }
+        first_.back() = false;
+    }
+    write_escaped(name);
+    out_.push_back(':');
+    pending_key_ = true;
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::value_null()
+{
+    value_prefix();
+    out_.append("null");
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::value(bool scalar)
+{
+    value_prefix();
+    out_.append(scalar ? "true" : "false");
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::value(long long scalar)
+{
+    value_prefix();
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), scalar);
+    out_.append(buffer, result.ptr);
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::value(unsigned long long scalar)
+{
+    value_prefix();
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), scalar);
+    out_.append(buffer, result.ptr);
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::value(double scalar)
+{
+    value_prefix();
+    // Shortest representation that round-trips; matches what the DOM
+    // serializer produces for finite values.
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), scalar);
+    out_.append(buffer, result.ptr);
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::value(std::string_view scalar)
+{
+    value_prefix();
+    write_escaped(scalar);
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::Flush()
+{
+    if (sink_ && !out_.empty())
+    {
+        sink_(out_.data(), out_.size());
+        out_.clear();
+    }
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::value_prefix()
+{
+    if (pending_key_)
+    {
+        pending_key_ = false;
+        return;
+    }
+    if (!first_.empty())
+    {
+        if (!first_.back())
+        {
+            out_.push_back(',');
+        }
+        first_.back() = false;
+    }
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::write_escaped(std::string_view text)
+{
+    out_.push_back('"');
+    for (const char character : text)
+    {
+        switch (character)
+        {
+            case '"':
+                out_.append("\\\"");
+                break;
+            case '\\':
+                out_.append("\\\\");
+                break;
+            case '\b':
+                out_.append("\\b");
+                break;
+            case '\f':
+                out_.append("\\f");
+                break;
+            case '\n':
+                out_.append("\\n");
+                break;
+            case '\r':
+                out_.append("\\r");
+                break;
+            case '\t':
+                out_.append("\\t");
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20U)
+                {
+                    char buffer[8];
+                    std::snprintf(
+                        buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(character));
+                    out_.append(buffer);
+                }
+                else
+                {
+                    out_.push_back(character);
+                }
+                break;
+        }
+    }
+    out_.push_back('"');
+}
+
+//----------------------------------------------------------------------------
+void json_emitter::maybe_flush()
+{
+    // Only flush between complete tokens so the sink always receives
+    // valid UTF-8 JSON fragments.
+    if (sink_ && out_.size() >= chunk_size_)
+    {
+        Flush();
+    }
+}
+
+}  // namespace serialization
@@ -0,0 +1,125 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @file json_emitter.h
+ * @brief Streaming JSON emitter used as a save-only archiver.
+ *
+ * The json archiver builds a full nlohmann DOM before a byte of text
+ * exists, which allocates a node tree as large as the object graph. The
+ * emitter is the SAX-style alternative: serializer_impl::save_object
+ * walks the reflection tuple and the emitter writes tokens straight into
+ * an output buffer (optionally flushed through a sink in fixed-size
+ * chunks). Output is compact JSON, structurally identical to what the
+ * DOM path produces. The emitter is save-only: there are no pop
+ * operations, so using it as a load archiver fails to compile.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "util/export.h"
+#include "util/registry.h"
+
+namespace serialization
+{
+class SERIALIZATION_VISIBILITY json_emitter
+{
+public:
+    json_emitter() = default;
+
+    /**
+     * Emits through @a sink in chunks of roughly @a chunk_size bytes
+     * instead of accumulating the whole document in memory.
+     */
+    explicit json_emitter(
+        std::function<void(const char*, size_t)> sink, size_t chunk_size = 65536);
+
+    //@{
+    /**
+     * Structural tokens. Scopes nest; end must match the open scope.
+     */
+    void begin_object();
+    void end_object();
+    void begin_array();
+    void end_array();
+    //@}
+
+    /**
+     * Emits the key of the next object member.
+     */
+    void key(std::string_view name);
+
+    //@{
+    /**
+     * Scalar values. Separators between siblings are inserted here, so
+     * callers only emit tokens in document order.
+     */
+    void value_null();
+    void value(bool scalar);
+    void value(long long scalar);
+    void value(unsigned long long scalar);
+    void value(double scalar);
+    void value(std::string_view scalar);
+    //@}
+
+    /**
+     * Pushes any bytes still buffered into the sink.
+     */
+    void Flush();
+
+    /**
+     * Returns the accumulated document (empty when a sink is attached).
+     */
+    [[nodiscard]] const std::string& str() const { return out_; }
+
+    [[nodiscard]] std::string take() && { return std::move(out_); }
+
+private:
+    void value_prefix();
+    void write_escaped(std::string_view text);
+    void maybe_flush();
+
+    std::string                              out_;
+    std::vector<bool>                        first_;
+    bool                                     pending_key_ = false;
+    std::function<void(const char*, size_t)> sink_;
+    size_t                                   chunk_size_ = 65536;
+};
+
+/**
+ * @brief True when Archiver is the streaming JSON emitter.
+ *
+ * Used by serializer_impl to emit the structural begin/end tokens the
+ * emitter needs but a random-access DOM does not.
+ */
+template <typename Archiver>
+inline constexpr bool is_json_emitter_v =
+    std::is_same_v<std::remove_cv_t<Archiver>, json_emitter>;
+
+/// @brief Function type for streaming-emitter serialization callbacks;
+/// a plain function pointer, matching the other serialization registries
+using emitter_serialization_function_t = void (*)(json_emitter&, void*, bool);
+
+SERIALIZATION_API SERIALIZATION_DECLARE_FUNCTION_REGISTRY(
+    JsonEmitterSerializationRegistry, emitter_serialization_function_t);
+
+}  // namespace serialization
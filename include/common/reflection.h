@@ -15,10 +15,13 @@ limitations under the License.
 
 #pragma once
 
+#include <cstdint>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 
+#include "util/flat_hash.h"
+
 namespace serialization
 {
 
@@ -29,6 +32,29 @@ constexpr void for_sequence(std::integer_sequence<T, S...>, F&& f)
     (f(std::integral_constant<T, S>{}), ...);
 }
 
+/**
+ * @brief Pre-hashed handle for a reflected field name.
+ *
+ * Reflection names are constexpr string_views, so their FNV-1a hash can
+ * be computed at compile time too. Archivers that key maps by field name
+ * accept the handle and reuse the stored hash instead of re-hashing the
+ * bytes on every lookup. Converts implicitly to string_view so handles
+ * pass anywhere a plain name does.
+ */
+struct field_name
+{
+    std::string_view name;
+    uint64_t         hash = 0;
+
+    constexpr field_name() = default;
+    constexpr explicit field_name(std::string_view n) noexcept
+        : name(n), hash(quarisma::fnv1a(n))
+    {
+    }
+
+    constexpr operator std::string_view() const noexcept { return name; }
+};
+
 // Reflection for class members
 template <typename Class, typename T>
 class reflection_impl
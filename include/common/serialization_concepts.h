@@ -102,6 +102,14 @@ concept MapLike = AssociativeContainer<T> && requires { typename T::mapped_type;
 template <typename T>
 concept SetLike = AssociativeContainer<T> && !MapLike<T>;
 
+/**
+ * @brief Concept for ordered (tree-based) associative containers, which
+ * expose a key_compare predicate; the unordered hash variants do not.
+ */
+template <typename T>
+concept OrderedAssociativeContainer =
+    AssociativeContainer<T> && requires { typename T::key_compare; };
+
 /**
  * @brief Concept for types that have reflection metadata
  */
@@ -0,0 +1,194 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "common/xml_emitter.h"
+
+#include <cassert>
+#include <charconv>
+#include <utility>
+
+namespace serialization
+{
+SERIALIZATION_API SERIALIZATION_DEFINE_FUNCTION_REGISTRY(
+    XmlEmitterSerializationRegistry, xml_emitter_serialization_function_t);
+
+//----------------------------------------------------------------------------
+xml_emitter::xml_emitter(std::function<void(const char*, size_t)> sink, size_t chunk_size)
+    : sink_(std::move(sink)), chunk_size_(chunk_size > 0 ? chunk_size : 65536)
+{
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::declaration()
+{
+    out_.append("<?xml version=\"1.0\"?>\n");
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::begin_element(std::string_view name)
+{
+    close_open_tag();
+    out_.push_back('<');
+    out_.append(name);
+    open_elements_.emplace_back(name);
+    open_tag_ = true;
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::end_element()
+{
+    assert("end_element without matching begin_element" && !open_elements_.empty());
+    if (open_tag_)
+    {
+        // Neither text nor children were written: self-close.
+        out_.append("/>");
+        open_tag_ = false;
+    }
+    else
+    {
+        out_.append("</");
+        out_.append(open_elements_.back());
+        out_.push_back('>');
+    }
+    open_elements_.pop_back();
+    maybe_flush();
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::attribute(std::string_view name, std::string_view value)
+{
+    assert("attribute after element content" && open_tag_);
+    out_.push_back(' ');
+    out_.append(name);
+    out_.append("=\"");
+    write_escaped(value, true);
+    out_.push_back('"');
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::attribute(std::string_view name, unsigned long long value)
+{
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    attribute(name, std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::text(std::string_view value)
+{
+    close_open_tag();
+    write_escaped(value, false);
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::text(bool value)
+{
+    close_open_tag();
+    out_.append(value ? "true" : "false");
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::text(long long value)
+{
+    close_open_tag();
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out_.append(buffer, result.ptr);
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::text(unsigned long long value)
+{
+    close_open_tag();
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out_.append(buffer, result.ptr);
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::text(double value)
+{
+    close_open_tag();
+    // Shortest representation that round-trips through the DOM loader.
+    char buffer[32];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out_.append(buffer, result.ptr);
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::Flush()
+{
+    if (sink_ && !out_.empty())
+    {
+        sink_(out_.data(), out_.size());
+        out_.clear();
+    }
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::close_open_tag()
+{
+    if (open_tag_)
+    {
+        out_.push_back('>');
+        open_tag_ = false;
+    }
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::write_escaped(std::string_view value, bool in_attribute)
+{
+    for (const char character : value)
+    {
+        switch (character)
+        {
+            case '&':
+                out_.append("&amp;");
+                break;
+            case '<':
+                out_.append("&lt;");
+                break;
+            case '>':
+                out_.append("&gt;");
+                break;
+            case '"':
+                if (in_attribute)
+                {
+                    out_.append("&quot;");
+                }
+                else
+                {
+                    out_.push_back(character);
+                }
+                break;
+            default:
+                out_.push_back(character);
+                break;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+void xml_emitter::maybe_flush()
+{
+    // Only flush between complete tokens so the sink always receives
+    // well-formed XML fragments.
+    if (sink_ && out_.size() >= chunk_size_)
+    {
+        Flush();
+    }
+}
+
+}  // namespace serialization
@@ -0,0 +1,132 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @file xml_emitter.h
+ * @brief Forward-only streaming XML writer used as a save-only archiver.
+ *
+ * access::write_to_xml builds a full pugi::xml_document and then
+ * re-serializes it, so two complete representations of the data are
+ * alive at once. The emitter writes tags directly into an output buffer
+ * (optionally flushed through a sink in fixed-size chunks) as the object
+ * graph is walked; only the open-element name stack is retained, so
+ * memory is O(depth) instead of O(document). Output parses back through
+ * the regular DOM load path. The emitter is save-only: there are no pop
+ * operations, so using it as a load archiver fails to compile.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "util/export.h"
+#include "util/registry.h"
+
+namespace serialization
+{
+class SERIALIZATION_VISIBILITY xml_emitter
+{
+public:
+    xml_emitter() = default;
+
+    /**
+     * Emits through @a sink in chunks of roughly @a chunk_size bytes
+     * instead of accumulating the whole document in memory.
+     */
+    explicit xml_emitter(
+        std::function<void(const char*, size_t)> sink, size_t chunk_size = 65536);
+
+    /**
+     * Emits the XML declaration; call once before the root element.
+     */
+    void declaration();
+
+    //@{
+    /**
+     * Structural tokens. Elements nest; end closes the innermost open
+     * element, self-closing it when it has neither text nor children.
+     */
+    void begin_element(std::string_view name);
+    void end_element();
+    //@}
+
+    //@{
+    /**
+     * Attributes of the current element. Only valid between
+     * begin_element and the first text or child element.
+     */
+    void attribute(std::string_view name, std::string_view value);
+    void attribute(std::string_view name, unsigned long long value);
+    //@}
+
+    //@{
+    /**
+     * Element text. Closes the open tag; the element still needs its
+     * end_element.
+     */
+    void text(std::string_view value);
+    void text(bool value);
+    void text(long long value);
+    void text(unsigned long long value);
+    void text(double value);
+    //@}
+
+    /**
+     * Pushes any bytes still buffered into the sink.
+     */
+    void Flush();
+
+    /**
+     * Returns the accumulated document (empty when a sink is attached).
+     */
+    [[nodiscard]] const std::string& str() const { return out_; }
+
+    [[nodiscard]] std::string take() && { return std::move(out_); }
+
+private:
+    void close_open_tag();
+    void write_escaped(std::string_view value, bool in_attribute);
+    void maybe_flush();
+
+    std::string                              out_;
+    std::vector<std::string>                 open_elements_;
+    bool                                     open_tag_ = false;
+    std::function<void(const char*, size_t)> sink_;
+    size_t                                   chunk_size_ = 65536;
+};
+
+/**
+ * @brief True when Archiver is the streaming XML emitter.
+ *
+ * Used by serializer_impl to close the element an indexed or named get
+ * opened, which a random-access DOM does not need.
+ */
+template <typename Archiver>
+inline constexpr bool is_xml_emitter_v =
+    std::is_same_v<std::remove_cv_t<Archiver>, xml_emitter>;
+
+/// @brief Function type for streaming XML emitter serialization callbacks;
+/// a plain function pointer, matching the other serialization registries
+using xml_emitter_serialization_function_t = void (*)(xml_emitter&, void*, bool);
+
+SERIALIZATION_API SERIALIZATION_DECLARE_FUNCTION_REGISTRY(
+    XmlEmitterSerializationRegistry, xml_emitter_serialization_function_t);
+
+}  // namespace serialization
@@ -1,20 +1,234 @@
 #include "serialization.h"
 
 #include <algorithm>
+#include <cstring>
 #include <cstddef>
 #include <fstream>
 #include <iomanip>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "common/archiver_wrapper.h"
+#include "util/async_file_writer.h"
+#include "util/byte_swap.h"
 
 namespace serialization::serialization_impl
 {
+namespace
+{
+// Footer layout, back to front: endianness byte (as in every raw
+// archive), 4-byte "FIDX" magic, 8-byte footer size, then the entry
+// records: u32 path size, path bytes, u64 offset, u64 length.
+constexpr unsigned char kFieldIndexMagic[4] = {'F', 'I', 'D', 'X'};
+
+template <typename Word>
+void append_word(std::vector<unsigned char>& raw, Word value)
+{
+    unsigned char bytes[sizeof(Word)];
+    std::memcpy(bytes, &value, sizeof(Word));
+    raw.insert(raw.end(), bytes, bytes + sizeof(Word));
+}
+
+template <typename Word>
+Word read_word(const unsigned char* data, bool swap)
+{
+    Word value;
+    std::memcpy(&value, data, sizeof(Word));
+    return swap ? byte_swap(value) : value;
+}
+//----------------------------------------------------------------------------
+// One node of the byte-attribution tree built from the field index.
+struct profile_node
+{
+    uint64_t                            bytes{0};
+    uint64_t                            count{0};
+    std::map<std::string, profile_node> children;
+};
+
+//----------------------------------------------------------------------------
+json emit_profile_fields(const profile_node& node, size_t total_bytes)
+{
+    // Largest consumers first: that is the order the report is read in.
+    std::vector<const std::pair<const std::string, profile_node>*> ordered;
+    ordered.reserve(node.children.size());
+    for (const auto& child : node.children)
+    {
+        ordered.push_back(&child);
+    }
+    std::sort(
+        ordered.begin(),
+        ordered.end(),
+        [](const auto* lhs, const auto* rhs)
+        {
+            if (lhs->second.bytes != rhs->second.bytes)
+            {
+                return lhs->second.bytes > rhs->second.bytes;
+            }
+            return lhs->first < rhs->first;
+        });
+
+    json fields = json::object();
+    for (const auto* child : ordered)
+    {
+        json entry;
+        entry["bytes"] = child->second.bytes;
+        entry["count"] = child->second.count;
+        entry["share"] = total_bytes != 0
+                             ? static_cast<double>(child->second.bytes) /
+                                   static_cast<double>(total_bytes)
+                             : 0.0;
+        if (!child->second.children.empty())
+        {
+            entry["fields"] = emit_profile_fields(child->second, total_bytes);
+        }
+        fields[child->first] = std::move(entry);
+    }
+    return fields;
+}
+}  // namespace
+
+//----------------------------------------------------------------------------
+json access::build_size_profile(
+    const std::vector<field_index_entry>& entries, size_t total_bytes)
+{
+    profile_node root;
+    uint64_t     attributed = 0;
+    for (const auto& entry : entries)
+    {
+        // Walk the dotted reflection path, creating nodes on the way.
+        profile_node* node  = &root;
+        size_t        start = 0;
+        while (start <= entry.path.size())
+        {
+            const size_t dot = entry.path.find('.', start);
+            const size_t end = dot == std::string::npos ? entry.path.size() : dot;
+            node             = &node->children[entry.path.substr(start, end - start)];
+            if (dot == std::string::npos)
+            {
+                break;
+            }
+            start = dot + 1;
+        }
+        node->bytes += entry.length;
+        node->count += 1;
+        if (entry.path.find('.') == std::string::npos)
+        {
+            attributed += entry.length;
+        }
+    }
+
+    json report;
+    report["total_bytes"] = total_bytes;
+    report["unattributed_bytes"] =
+        total_bytes >= attributed ? total_bytes - attributed : 0;
+    report["fields"] = emit_profile_fields(root, total_bytes);
+    return report;
+}
+
+void access::append_field_index_footer(
+    std::vector<unsigned char>& raw, const std::vector<field_index_entry>& entries)
+{
+    // The endianness byte stays the last byte of the raw data.
+    const unsigned char endianness = raw.back();
+    raw.pop_back();
+
+    const size_t footer_start = raw.size();
+    for (const auto& entry : entries)
+    {
+        append_word(raw, static_cast<uint32_t>(entry.path.size()));
+        raw.insert(raw.end(), entry.path.begin(), entry.path.end());
+        append_word(raw, static_cast<uint64_t>(entry.offset));
+        append_word(raw, static_cast<uint64_t>(entry.length));
+    }
+
+    append_word(raw, static_cast<uint64_t>(raw.size() - footer_start));
+    raw.insert(raw.end(), kFieldIndexMagic, kFieldIndexMagic + sizeof(kFieldIndexMagic));
+    raw.push_back(endianness);
+}
+
+bool access::find_indexed_field(
+    const std::vector<unsigned char>& raw,
+    const std::string&                path,
+    size_t&                           offset,
+    size_t&                           length)
+{
+    constexpr size_t trailer = 1 + sizeof(kFieldIndexMagic) + sizeof(uint64_t);
+    if (raw.size() < trailer)
+    {
+        return false;
+    }
+
+    const size_t n = raw.size();
+    if (std::memcmp(raw.data() + n - 5, kFieldIndexMagic, sizeof(kFieldIndexMagic)) != 0)
+    {
+        return false;
+    }
+
+    // The footer words are written in the producer's byte order, recorded
+    // in the trailing endianness byte.
+    const bool swap = raw.back() != serialization::multi_process_stream().endianness();
+
+    const auto footer_size = read_word<uint64_t>(raw.data() + n - trailer, swap);
+    if (footer_size > n - trailer)
+    {
+        return false;
+    }
+
+    const unsigned char* cursor = raw.data() + n - trailer - footer_size;
+    const unsigned char* end    = raw.data() + n - trailer;
+    while (cursor + sizeof(uint32_t) <= end)
+    {
+        const auto path_size = read_word<uint32_t>(cursor, swap);
+        cursor += sizeof(uint32_t);
+        if (cursor + path_size + 2 * sizeof(uint64_t) > end)
+        {
+            return false;
+        }
+
+        const bool match =
+            path.size() == path_size &&
+            std::memcmp(path.data(), cursor, path_size) == 0;
+        cursor += path_size;
+
+        if (match)
+        {
+            offset = static_cast<size_t>(read_word<uint64_t>(cursor, swap));
+            length = static_cast<size_t>(read_word<uint64_t>(cursor + sizeof(uint64_t), swap));
+            return true;
+        }
+        cursor += 2 * sizeof(uint64_t);
+    }
+    return false;
+}
+
 void access::write_binary(const std::string& fn, const std::vector<unsigned char>& buffer)
 {
     std::ofstream out(fn.c_str(), std::ios::binary | std::ios::ate);
     out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());  // NOLINT
 }
 
+namespace
+{
+serialization::async_file_writer& binary_writer()
+{
+    static serialization::async_file_writer writer;
+    return writer;
+}
+}  // namespace
+
+void access::write_binary_async(const std::string& fn, std::vector<unsigned char>&& buffer)
+{
+    binary_writer().enqueue(fn, std::move(buffer));
+}
+
+void access::flush_binary_writes()
+{
+    binary_writer().flush();
+}
+
 void access::read_binary(const std::string& fn, std::vector<unsigned char>& buffer)
 {
     std::ifstream in(fn.c_str(), std::ios::binary | std::ios::ate);
@@ -35,14 +249,93 @@ void access::read_binary(const std::string& fn, std::vector<unsigned char>& buff
 
 void access::read_json(const std::string& path, json& root)
 {
-    std::ifstream str(path);
-    str >> root;
+    // Parse a contiguous buffer instead of driving the parser through
+    // istream extraction, which is several times slower: map the file
+    // and hand the region to json::parse directly.
+    memory_mapped_file mapping(path);
+    if (mapping.data() != nullptr && mapping.size() > 0)
+    {
+        const char* begin = reinterpret_cast<const char*>(mapping.data());
+        root              = json::parse(begin, begin + mapping.size());
+        return;
+    }
+
+    // Mapping unavailable (e.g. empty or special file): buffered read
+    // into one string, then the same contiguous parse.
+    std::ifstream str(path, std::ios::binary);
+    std::string   text(
+        (std::istreambuf_iterator<char>(str)), std::istreambuf_iterator<char>());
+    root = json::parse(text);
 }
 
-void access::write_json(const std::string& path, const json& root)
+namespace
+{
+/**
+ * nlohmann output adapter that accumulates into a fixed-size buffer and
+ * flushes it to the file whenever it fills, so dumping a large document
+ * never materializes the full text in memory.
+ */
+class chunked_file_output final : public nlohmann::detail::output_adapter_protocol<char>
+{
+public:
+    explicit chunked_file_output(std::ofstream& out, size_t capacity = 65536) : out_(out)
+    {
+        buffer_.reserve(capacity);
+        capacity_ = capacity;
+    }
+
+    ~chunked_file_output() override { flush(); }
+
+    chunked_file_output(const chunked_file_output&)            = delete;
+    chunked_file_output& operator=(const chunked_file_output&) = delete;
+    chunked_file_output(chunked_file_output&&)                 = delete;
+    chunked_file_output& operator=(chunked_file_output&&)      = delete;
+
+    void write_character(char character) override
+    {
+        buffer_.push_back(character);
+        if (buffer_.size() >= capacity_)
+        {
+            flush();
+        }
+    }
+
+    void write_characters(const char* characters, std::size_t length) override
+    {
+        buffer_.append(characters, length);
+        if (buffer_.size() >= capacity_)
+        {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        if (!buffer_.empty())
+        {
+            out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+            buffer_.clear();
+        }
+    }
+
+private:
+    std::ofstream& out_;
+    std::string    buffer_;
+    size_t         capacity_;
+};
+}  // namespace
+
+void access::write_json(const std::string& path, const json& root, bool compact)
 {
     std::ofstream str(path);
-    str << std::setw(1) << root << std::endl;
+
+    // Drive nlohmann's serializer directly into the chunked adapter
+    // instead of formatting the whole document into one string first.
+    const auto adapter = std::make_shared<chunked_file_output>(str);
+    nlohmann::detail::serializer<json> dumper(adapter, ' ');
+    dumper.dump(root, !compact, false, compact ? 0U : 1U);
+    adapter->flush();
+    str << std::endl;
 }
 
 void access::read_xml(const std::string& path, pugi::xml_document& doc)
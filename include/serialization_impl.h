@@ -18,18 +18,30 @@ limitations under the License.
 
 static_assert(__cplusplus >= 202002L, "This header requires C++20 or later");
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
 #include <concepts>
+#include <coroutine>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
 #include <exception>
 #include <format>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <optional>
 #include <ranges>
 #include <source_location>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <type_traits>
 #include <typeinfo>
 #include <unordered_map>
@@ -41,10 +53,44 @@ static_assert(__cplusplus >= 202002L, "This header requires C++20 or later");
 #include "common/reflection.h"
 #include "common/serialization_concepts.h"
 #include "common/serialization_type_traits.h"
+#include "util/base64.h"
+#include "util/byte_swap.h"
+#include "util/configure.h"
 #include "util/pointer.h"
 #include "util/registry.h"
+#include "util/serialization_stats.h"
 #include "util/string_util.h"
 
+//-----------------------------------------------------------------------------
+// Dirty-field tracking
+//-----------------------------------------------------------------------------
+namespace serialization
+{
+/**
+ * @brief Per-object bitmask of reflected members changed since a baseline.
+ *
+ * One bit per non-empty reflection entry, in tuple order — the order the
+ * save and load plans walk. User code (typically a setter wrapper) marks
+ * a bit whenever the member changes; a dirty_fields_scope then makes
+ * save_object emit only the marked members, producing a delta archive
+ * against the last full snapshot. field_index translates a reflected
+ * member name into its bit position.
+ */
+struct dirty_mask
+{
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    std::uint64_t bits{0};
+
+    void mark(std::size_t index) { bits |= std::uint64_t{1} << index; }
+    void mark_all() { bits = ~std::uint64_t{0}; }
+    void clear() { bits = 0; }
+
+    [[nodiscard]] bool test(std::size_t index) const { return ((bits >> index) & 1U) != 0U; }
+    [[nodiscard]] bool any() const { return bits != 0; }
+};
+}  // namespace serialization
+
 //-----------------------------------------------------------------------------
 // Enhanced Error Handling with C++20
 //-----------------------------------------------------------------------------
@@ -57,36 +103,108 @@ namespace serialization::detail
 template <typename T>
 [[nodiscard]] inline const std::string& cached_type_name() noexcept
 {
-    static const std::string name = demangle(typeid(T).name());
-    return name;
+    return demangled_name(typeid(T));
 }
 
 /**
  * @brief Get type name for polymorphic objects with caching
+ *
+ * Delegates to the process-wide lock-free demangled_name cache, which the
+ * registries seed for every registered type, so the save hot path neither
+ * demangles nor allocates. The previous thread_local map cached every type
+ * once per thread and returned the name by value.
  */
 template <typename T>
-[[nodiscard]] inline std::string polymorphic_type_name(const T* obj) noexcept
+[[nodiscard]] inline const std::string& polymorphic_type_name(const T* obj) noexcept
 {
     if constexpr (std::is_polymorphic_v<T>)
     {
-        static thread_local std::unordered_map<const std::type_info*, std::string> cache;
-        const auto& type_info = typeid(*obj);
+        return demangled_name(typeid(*obj));
+    }
+    else
+    {
+        return cached_type_name<T>();
+    }
+}
 
-        auto it = cache.find(&type_info);
-        if (it != cache.end()) [[likely]]
+/**
+ * @brief Bump-pointer arena for transient load-path allocations.
+ *
+ * Deserialization stages class names and small scratch buffers that live
+ * only for the duration of one load call. The arena hands those out from
+ * recycled storage and releases everything wholesale afterwards, so the
+ * hot load path never round-trips through malloc/free per object.
+ */
+class load_arena
+{
+public:
+    /**
+     * Returns size bytes of uninitialized storage valid until release().
+     */
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        offset_ = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (blocks_.empty() || offset_ + size > block_size)
         {
-            return it->second;
+            if (size > block_size)
+            {
+                // Oversized requests get a dedicated block; keep the bump
+                // block untouched so small allocations stay contiguous.
+                oversized_.emplace_back(new unsigned char[size]);
+                return oversized_.back().get();
+            }
+            if (block_index_ + 1 < blocks_.size())
+            {
+                ++block_index_;
+            }
+            else
+            {
+                blocks_.emplace_back(new unsigned char[block_size]);
+                block_index_ = blocks_.size() - 1;
+            }
+            offset_ = 0;
         }
+        void* result = blocks_[block_index_].get() + offset_;
+        offset_ += size;
+        return result;
+    }
 
-        auto name         = demangle(type_info.name());
-        cache[&type_info] = name;
-        return name;
+    /**
+     * Returns a recycled std::string for staging; its previous capacity is
+     * kept across release() so repeated loads stop allocating entirely.
+     */
+    std::string& scratch_string()
+    {
+        if (strings_in_use_ == strings_.size())
+        {
+            strings_.emplace_back();
+        }
+        std::string& result = strings_[strings_in_use_++];
+        result.clear();
+        return result;
     }
-    else
+
+    /**
+     * Releases every allocation at once. Storage is retained for reuse.
+     */
+    void release()
     {
-        return cached_type_name<T>();
+        oversized_.clear();
+        block_index_    = 0;
+        offset_         = 0;
+        strings_in_use_ = 0;
     }
-}
+
+private:
+    static constexpr std::size_t block_size = 64 * 1024;
+
+    std::vector<std::unique_ptr<unsigned char[]>> blocks_;
+    std::vector<std::unique_ptr<unsigned char[]>> oversized_;
+    std::deque<std::string>                       strings_;
+    std::size_t                                   block_index_    = 0;
+    std::size_t                                   offset_         = 0;
+    std::size_t                                   strings_in_use_ = 0;
+};
 
 /**
  * @brief Serialization context for tracking depth and detecting cycles
@@ -96,6 +214,68 @@ struct serialization_context
     std::size_t                  depth     = 0;
     static constexpr std::size_t max_depth = 1000;
 
+    /**
+     * Pointer-identity tracking (see identity_tracking_scope): repeated
+     * shared_ptr targets are written once and then referenced by id. Ids
+     * are assigned in encounter order on both sides, so they never appear
+     * in the archive at the definition site.
+     */
+    bool                                          track_shared_identity = false;
+    std::unordered_map<const void*, unsigned int> shared_saved;
+    std::vector<std::shared_ptr<void>>            shared_loaded;
+
+    /**
+     * Arena backing transient strings and staging buffers for loads that
+     * run under this context; released wholesale when the load finishes.
+     */
+    load_arena arena;
+
+    /**
+     * Target memory resource for loaded pointer objects (see
+     * access::binary_deserialize): when set, shared_ptr targets are
+     * placement-constructed out of the caller's resource and their
+     * deleters only run the destructor and hand the bytes back, so a
+     * whole loaded graph lives in one arena and frees in O(1) when the
+     * arena is released.
+     */
+    std::pmr::memory_resource* memory_resource = nullptr;
+
+    /**
+     * Columnar JSON layout (see columnar_json_scope): containers of
+     * reflectable values are written struct-of-arrays instead of as an
+     * array of objects repeating every field name per element.
+     */
+    bool columnar_json = false;
+
+    /**
+     * Packed numeric encoding (see packed_numeric_scope): contiguous
+     * arithmetic containers are written to the text archivers as one
+     * base64 blob of their little-endian bytes.
+     */
+    bool packed_numeric = false;
+
+    /**
+     * Parallel container save (see parallel_save_scope): worker count
+     * used to serialize large containers to the binary archiver
+     * chunk-wise; zero keeps the sequential path.
+     */
+    std::size_t parallel_save_workers = 0;
+
+    /**
+     * Parallel container load (see parallel_load_scope): worker count
+     * used to deserialize large JSON arrays into pre-sized container
+     * slots; zero keeps the sequential path.
+     */
+    std::size_t parallel_load_workers = 0;
+
+    /**
+     * Dirty-field save (see dirty_fields_scope): when save_object reaches
+     * the registered object through a keyed archiver it emits only the
+     * members whose mask bits are set, yielding a delta archive.
+     */
+    const void*       dirty_object = nullptr;
+    const dirty_mask* dirty_fields = nullptr;
+
     struct depth_guard
     {
         serialization_context& ctx;
@@ -105,10 +285,9 @@ struct serialization_context
             ++ctx.depth;
             if (ctx.depth > ctx.max_depth) [[unlikely]]
             {
-                throw;  //_error(
-                        //serialization_error::error_code::recursion_limit,
-                        //"Serialization depth {} exceeds maximum {}",
-                        //ctx.depth, ctx.max_depth);
+                throw std::runtime_error(
+                    "Serialization depth exceeds maximum; the object graph "
+                    "is deeper than max_depth or contains an untracked cycle");
             }
         }
 
@@ -123,12 +302,194 @@ struct serialization_context
     [[nodiscard]] depth_guard enter() { return depth_guard(*this); }
 };
 
+/**
+ * @brief Context active on the current thread, or nullptr.
+ */
+inline serialization_context*& active_context() noexcept
+{
+    static thread_local serialization_context* context = nullptr;
+    return context;
+}
+
+/**
+ * @brief Installs a context as the active one for the current scope.
+ */
+struct scoped_active_context
+{
+    serialization_context* previous;
+
+    explicit scoped_active_context(serialization_context& context) : previous(active_context())
+    {
+        active_context() = &context;
+    }
+
+    ~scoped_active_context() { active_context() = previous; }
+
+    scoped_active_context(const scoped_active_context&)            = delete;
+    scoped_active_context& operator=(const scoped_active_context&) = delete;
+};
+
+/**
+ * @brief Routes pointer loads of the active context into a memory
+ * resource for the current scope, restoring the previous target on exit.
+ */
+struct scoped_memory_resource
+{
+    serialization_context&     context;
+    std::pmr::memory_resource* previous;
+
+    scoped_memory_resource(serialization_context& ctx, std::pmr::memory_resource* resource)
+        : context(ctx), previous(ctx.memory_resource)
+    {
+        if (resource != nullptr)
+        {
+            context.memory_resource = resource;
+        }
+    }
+
+    ~scoped_memory_resource() { context.memory_resource = previous; }
+
+    scoped_memory_resource(const scoped_memory_resource&)            = delete;
+    scoped_memory_resource& operator=(const scoped_memory_resource&) = delete;
+};
+
+/**
+ * @brief Constructs the target of a loaded shared_ptr. With a memory
+ * resource on the active context the object is placement-constructed in
+ * the caller's arena — allocator-aware types are handed the resource so
+ * their own allocations follow — and the deleter only destroys and
+ * returns the bytes; otherwise an ordinary heap allocation.
+ */
+template <typename T>
+std::shared_ptr<T> make_loaded_shared()
+{
+    auto* context = active_context();
+    if (context == nullptr || context->memory_resource == nullptr)
+    {
+        return std::shared_ptr<T>(serialization::access::serializer::make_ptr<T>().release());
+    }
+
+    std::pmr::memory_resource* resource = context->memory_resource;
+    void*                      storage  = resource->allocate(sizeof(T), alignof(T));
+    T*                         object   = nullptr;
+    try
+    {
+        if constexpr (std::uses_allocator_v<T, std::pmr::polymorphic_allocator<std::byte>> &&
+                      std::is_constructible_v<T, std::pmr::polymorphic_allocator<std::byte>>)
+        {
+            object = ::new (storage) T(std::pmr::polymorphic_allocator<std::byte>(resource));
+        }
+        else
+        {
+            object = serialization::access::serializer::construct_at<T>(storage);
+        }
+    }
+    catch (...)
+    {
+        resource->deallocate(storage, sizeof(T), alignof(T));
+        throw;
+    }
+    return std::shared_ptr<T>(
+        object,
+        [resource](T* pointer)
+        {
+            serialization::access::serializer::destruct(*pointer);
+            resource->deallocate(pointer, sizeof(T), alignof(T));
+        });
+}
+
+//-----------------------------------------------------------------------------
+// Error reporting
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Exception thrown when an archive fails validation during load.
+ *
+ * Carries a machine-checkable error_code next to the formatted message,
+ * so intake pipelines can branch on the failure kind without parsing
+ * text.
+ */
+class serialization_error : public std::runtime_error
+{
+public:
+    enum class error_code
+    {
+        none,
+        size_mismatch,
+        missing_field,
+        invalid_variant,
+        invalid_index,
+        null_pointer,
+        registry_not_found,
+        schema_mismatch,
+        unknown
+    };
+
+    serialization_error(error_code code, const std::string& message)
+        : std::runtime_error(message), code_(code)
+    {
+    }
+
+    [[nodiscard]] error_code code() const noexcept { return code_; }
+
+private:
+    error_code code_;
+};
+
+/**
+ * @brief Failure description surfaced by the checked load entry points.
+ */
+struct load_error
+{
+    serialization_error::error_code code = serialization_error::error_code::none;
+    std::string                     message;
+};
+
+//-----------------------------------------------------------------------------
+// In result-code mode (SERIALIZATION_ENABLE_EXCEPTIONS=0) a failed check
+// cannot unwind the load, so the first failure on the thread is parked
+// here and the load continues best-effort; the checked facade entry
+// points collect it afterwards.
+inline load_error& pending_load_error() noexcept
+{
+    static thread_local load_error slot;
+    return slot;
+}
+
+//-----------------------------------------------------------------------------
+inline void record_load_error(
+    serialization_error::error_code code, std::string message) noexcept
+{
+    load_error& slot = pending_load_error();
+    if (slot.code == serialization_error::error_code::none)
+    {
+        slot.code    = code;
+        slot.message = std::move(message);
+    }
+}
+
+//-----------------------------------------------------------------------------
+[[nodiscard]] inline load_error take_load_error() noexcept
+{
+    return std::exchange(pending_load_error(), load_error{});
+}
+
 }  // namespace serialization::detail
 
 //-----------------------------------------------------------------------------
 // Macros for error handling
 //-----------------------------------------------------------------------------
-#define SERIALIZATION_THROW(code, ...)
+// Default mode throws serialization_error; compiling with
+// SERIALIZATION_ENABLE_EXCEPTIONS=0 (see util/configure.h) replaces the
+// throw with a thread-local error record for the checked entry points,
+// keeping malformed-input-heavy hot paths free of unwind machinery.
+#if SERIALIZATION_ENABLE_EXCEPTIONS
+#define SERIALIZATION_THROW(code, ...) \
+    throw serialization::detail::serialization_error(code, std::format(__VA_ARGS__))
+#else
+#define SERIALIZATION_THROW(code, ...) \
+    serialization::detail::record_load_error(code, std::format(__VA_ARGS__))
+#endif
 
 #define SERIALIZATION_CHECK(condition, code, ...)                                     \
     do                                                                                \
@@ -167,6 +528,10 @@ inline constexpr std::string_view VALUE_NAME = "Value";
 inline constexpr std::string_view INDEX_NAME = "Index";
 inline constexpr std::string_view EMPTY_NAME = "null object!";
 
+// Class-name marker of a back-reference record written when identity
+// tracking is active; followed by the id of the referenced object.
+inline constexpr std::string_view REFERENCE_NAME = "@reference";
+
 //-----------------------------------------------------------------------------
 // Forward declarations
 //-----------------------------------------------------------------------------
@@ -180,6 +545,19 @@ template <typename Archiver, typename T>
              TupleLike<T> || VariantLike<T> || OptionalLike<T>)
 void load(Archiver& archive, T& obj);
 
+// Overloads taking an explicit serialization context (cycle detection,
+// depth guarding, identity tracking). The context-free overloads above
+// remain the compatible default.
+template <typename Archiver, typename T>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+void save(Archiver& archive, const T& obj, detail::serialization_context& context);
+
+template <typename Archiver, typename T>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+void load(Archiver& archive, T& obj, detail::serialization_context& context);
+
 // Overloads for rvalue references (e.g., XML nodes returned by value)
 // Constrained to only match actual rvalues (not forwarding references)
 template <typename Archiver, typename T>
@@ -194,84 +572,1333 @@ template <typename Archiver, typename T>
              TupleLike<T> || VariantLike<T> || OptionalLike<T>)
 void load(Archiver&& archive, T& obj);
 
+// Value-returning loads: the type leads the parameter list so call sites
+// read serialization::load<T>(archive).
+template <typename T, typename Archiver>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+[[nodiscard]] T load(Archiver& archive);
+
+template <typename T, typename Archiver>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+[[nodiscard]] T load(Archiver& archive, detail::serialization_context& context);
+
+template <typename T, typename Archiver>
+    requires(!std::is_lvalue_reference_v<Archiver>) &&
+            (BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+[[nodiscard]] T load(Archiver&& archive);
+
 //-----------------------------------------------------------------------------
-// Registry registration helper with const-correctness
+// Pointer-identity tracking
 //-----------------------------------------------------------------------------
-namespace detail
+/**
+ * @brief Enables shared_ptr identity tracking for the enclosed save/load.
+ *
+ * While a scope is alive on the current thread, repeated shared_ptr
+ * targets are serialized once and later occurrences are written as
+ * reference records resolved back to the same shared object on load, so
+ * sharing semantics (and archive size) survive a round trip. Use one
+ * scope per archive:
+ *
+ * @code
+ *   serialization::identity_tracking_scope scope;
+ *   serialization::save(buffer, graph);
+ *   serialization::load(buffer, restored);
+ * @endcode
+ */
+class identity_tracking_scope
 {
-template <typename Archiver, typename T>
-void save_polymorphic(Archiver& archive, const T& obj)
+public:
+    identity_tracking_scope()
+    {
+        context_.track_shared_identity = true;
+        previous_                      = detail::active_context();
+        detail::active_context()       = &context_;
+    }
+
+    ~identity_tracking_scope() { detail::active_context() = previous_; }
+
+    identity_tracking_scope(const identity_tracking_scope&)            = delete;
+    identity_tracking_scope& operator=(const identity_tracking_scope&) = delete;
+
+private:
+    detail::serialization_context  context_;
+    detail::serialization_context* previous_{nullptr};
+};
+
+/**
+ * @brief Opt-in columnar (struct-of-arrays) JSON layout.
+ *
+ * While a scope is alive on the current thread, a container of
+ * reflectable values saved to the json archiver is written as one object
+ * holding a Size and a field-name-to-array Columns mapping instead of an
+ * array of objects, so repeated keys stop dominating large homogeneous
+ * payloads. Loading needs no scope: load_container recognizes the
+ * columnar object and re-inflates it transparently.
+ */
+class columnar_json_scope
 {
-    serialization::save(archive, obj);
-}
+public:
+    columnar_json_scope()
+    {
+        context_.columnar_json   = true;
+        previous_                = detail::active_context();
+        detail::active_context() = &context_;
+    }
 
-template <typename Archiver, typename T>
-void load_polymorphic(Archiver& archive, T& obj)
+    ~columnar_json_scope() { detail::active_context() = previous_; }
+
+    columnar_json_scope(const columnar_json_scope&)            = delete;
+    columnar_json_scope& operator=(const columnar_json_scope&) = delete;
+
+private:
+    detail::serialization_context  context_;
+    detail::serialization_context* previous_{nullptr};
+};
+
+/**
+ * @brief Opt-in packed (base64) encoding for numeric containers.
+ *
+ * While a scope is alive on the current thread, a contiguous container
+ * of arithmetic values saved to the json or xml archiver is written as a
+ * single base64 blob of its little-endian bytes instead of one node per
+ * element. Loading needs no scope: load_container recognizes the packed
+ * record and decodes it transparently.
+ */
+class packed_numeric_scope
 {
-    serialization::load(archive, obj);
-}
-}  // namespace detail
+public:
+    packed_numeric_scope()
+    {
+        context_.packed_numeric  = true;
+        previous_                = detail::active_context();
+        detail::active_context() = &context_;
+    }
 
-template <typename Archiver, typename T>
-void register_serializer_impl(Archiver& archive, void* obj, bool load_obj)
+    ~packed_numeric_scope() { detail::active_context() = previous_; }
+
+    packed_numeric_scope(const packed_numeric_scope&)            = delete;
+    packed_numeric_scope& operator=(const packed_numeric_scope&) = delete;
+
+private:
+    detail::serialization_context  context_;
+    detail::serialization_context* previous_{nullptr};
+};
+
+/**
+ * @brief Opt-in parallel container save for the binary archiver.
+ *
+ * While a scope is alive on the current thread, containers at or past
+ * the element threshold saved to the binary archiver are serialized by
+ * a worker pool into per-chunk segments spliced back in element order,
+ * so the resulting bytes are identical to a sequential save and loading
+ * needs no scope. @a workers selects the pool size; zero means one
+ * worker per hardware thread.
+ */
+class parallel_save_scope
 {
-    if (load_obj)
+public:
+    explicit parallel_save_scope(size_t workers = 0)
     {
-        auto* obj_ptr       = static_cast<ptr_const<T>*>(obj);
-        auto  loaded_object = serialization::access::serializer::make_ptr<T>();
-        detail::load_polymorphic(archive, *loaded_object);
-        obj_ptr->reset(loaded_object.release());
+        context_.parallel_save_workers =
+            workers != 0 ? workers : std::max<size_t>(1, std::thread::hardware_concurrency());
+        previous_                = detail::active_context();
+        detail::active_context() = &context_;
     }
-    else
+
+    ~parallel_save_scope() { detail::active_context() = previous_; }
+
+    parallel_save_scope(const parallel_save_scope&)            = delete;
+    parallel_save_scope& operator=(const parallel_save_scope&) = delete;
+
+private:
+    detail::serialization_context  context_;
+    detail::serialization_context* previous_{nullptr};
+};
+
+/**
+ * @brief Opt-in parallel container load from the JSON archiver.
+ *
+ * While a scope is alive on the current thread, large JSON arrays load
+ * into pre-sized container slots through a worker pool: each element is
+ * an independent subtree, so workers claim index ranges off a shared
+ * ticket and only the join synchronizes. The archive is not modified
+ * during the load. @a workers selects the pool size; zero means one
+ * worker per hardware thread.
+ */
+class parallel_load_scope
+{
+public:
+    explicit parallel_load_scope(size_t workers = 0)
     {
-        const auto* obj_ptr = static_cast<const T*>(obj);
-        detail::save_polymorphic(archive, *obj_ptr);
+        context_.parallel_load_workers =
+            workers != 0 ? workers : std::max<size_t>(1, std::thread::hardware_concurrency());
+        previous_                = detail::active_context();
+        detail::active_context() = &context_;
     }
+
+    ~parallel_load_scope() { detail::active_context() = previous_; }
+
+    parallel_load_scope(const parallel_load_scope&)            = delete;
+    parallel_load_scope& operator=(const parallel_load_scope&) = delete;
+
+private:
+    detail::serialization_context  context_;
+    detail::serialization_context* previous_{nullptr};
+};
+
+/**
+ * @brief Looks up a member's dirty-mask bit position by reflected name.
+ *
+ * Indices count the non-empty reflection entries of T in tuple order,
+ * matching the save/load plan step order. Returns dirty_mask::npos when
+ * T has no member of that name; usable in constant expressions, so a
+ * misspelled name can be caught with static_assert.
+ */
+template <typename T>
+[[nodiscard]] constexpr std::size_t field_index(std::string_view name)
+{
+    std::size_t index = 0;
+    std::size_t found = dirty_mask::npos;
+    for_sequence(
+        std::make_index_sequence<
+            std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            constexpr auto property = std::get<I>(serialization::access::serializer::tuple<T>());
+            if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+            {
+                if (found == dirty_mask::npos && std::string_view{property.name()} == name)
+                {
+                    found = index;
+                }
+                ++index;
+            }
+        });
+    return found;
 }
 
-//-----------------------------------------------------------------------------
-namespace impl
+/**
+ * @brief Opt-in dirty-field (delta) save for one object.
+ *
+ * While a scope is alive on the current thread, save_object writes only
+ * the marked members of the registered object when saving through a
+ * keyed archiver, producing a delta archive; everything else — nested
+ * objects, other types, the binary archiver whose layout is positional —
+ * still saves in full. Loading a delta onto the baseline object updates
+ * exactly the members present (absent members keep their values), and
+ * merge_delta compacts a chain of deltas into one archive.
+ */
+class dirty_fields_scope
+{
+public:
+    template <typename T>
+    dirty_fields_scope(const T& object, const dirty_mask& mask)
+    {
+        context_.dirty_object    = &object;
+        context_.dirty_fields    = &mask;
+        previous_                = detail::active_context();
+        detail::active_context() = &context_;
+    }
+
+    ~dirty_fields_scope() { detail::active_context() = previous_; }
+
+    dirty_fields_scope(const dirty_fields_scope&)            = delete;
+    dirty_fields_scope& operator=(const dirty_fields_scope&) = delete;
+
+private:
+    detail::serialization_context  context_;
+    detail::serialization_context* previous_{nullptr};
+};
+
+/**
+ * @brief Folds the delta archive @a delta into @a baseline in place.
+ *
+ * Matching object members merge recursively and everything else is
+ * overwritten, so replaying a chain of dirty-field saves compacts into
+ * one archive equivalent to their in-order application. The result
+ * loads like any full archive.
+ */
+inline void merge_delta(json& baseline, const json& delta)
 {
+    if (!baseline.is_object() || !delta.is_object())
+    {
+        baseline = delta;
+        return;
+    }
+    for (const auto& item : delta.items())
+    {
+        if (auto it = baseline.find(item.key()); it != baseline.end())
+        {
+            merge_delta(*it, item.value());
+        }
+        else
+        {
+            baseline[item.key()] = item.value();
+        }
+    }
+}
 
 //-----------------------------------------------------------------------------
-// Container serialization - Sequential containers (C++20 concepts)
+// Delta archives: diff against a baseline, apply as a patch
 //-----------------------------------------------------------------------------
+namespace detail
+{
+/**
+ * Recursive diff of two reflection-shaped json trees. Matching object
+ * members and same-sized arrays recurse; any other difference replaces
+ * the whole subtree at the current path. @a path is the dotted segment
+ * stack ("curves.3.rate") shared across the walk.
+ */
+inline void diff_json_leaves(
+    const json& baseline, const json& current, std::string& path, json& patch)
+{
+    if (baseline.is_object() && current.is_object())
+    {
+        // A dropped key cannot be expressed as a leaf write; replace the
+        // object wholesale. Reflection-shaped trees never hit this.
+        for (const auto& item : baseline.items())
+        {
+            if (!current.contains(item.key()))
+            {
+                patch[path] = current;
+                return;
+            }
+        }
+        for (const auto& item : current.items())
+        {
+            const size_t mark = path.size();
+            if (!path.empty())
+            {
+                path.push_back('.');
+            }
+            path.append(item.key());
+            if (const auto it = baseline.find(item.key()); it != baseline.end())
+            {
+                diff_json_leaves(*it, item.value(), path, patch);
+            }
+            else
+            {
+                patch[path] = item.value();
+            }
+            path.resize(mark);
+        }
+        return;
+    }
+    if (baseline.is_array() && current.is_array() && baseline.size() == current.size())
+    {
+        for (size_t i = 0; i < current.size(); ++i)
+        {
+            const size_t mark = path.size();
+            if (!path.empty())
+            {
+                path.push_back('.');
+            }
+            path.append(std::to_string(i));
+            diff_json_leaves(baseline[i], current[i], path, patch);
+            path.resize(mark);
+        }
+        return;
+    }
+    if (baseline != current)
+    {
+        patch[path] = current;
+    }
+}
+}  // namespace detail
+
+/**
+ * @brief Diffs two archives of the same shape into a flat patch.
+ *
+ * The patch maps stable dotted field paths to the new values of exactly
+ * the leaves that differ, so a replication link resends only what moved.
+ * Containers that changed size (and any other structural change) appear
+ * as one entry replacing the whole subtree; the empty path replaces the
+ * root. Field names must not themselves contain dots.
+ */
+[[nodiscard]] inline json make_patch(const json& baseline, const json& current)
+{
+    json        patch = json::object();
+    std::string path;
+    detail::diff_json_leaves(baseline, current, path, patch);
+    return patch;
+}
+
+/**
+ * @brief Applies a make_patch result to @a archive in place.
+ */
+inline void apply_patch(json& archive, const json& patch)
+{
+    for (const auto& item : patch.items())
+    {
+        json* node = &archive;
+        if (!item.key().empty())
+        {
+            std::string_view rest = item.key();
+            while (!rest.empty())
+            {
+                const size_t           dot     = rest.find('.');
+                const std::string_view segment = rest.substr(0, dot);
+                rest = dot == std::string_view::npos ? std::string_view{} : rest.substr(dot + 1);
+                if (node->is_array())
+                {
+                    size_t index = 0;
+                    std::from_chars(segment.data(), segment.data() + segment.size(), index);
+                    node = &(*node)[index];
+                }
+                else
+                {
+                    node = &(*node)[std::string(segment)];
+                }
+            }
+        }
+        *node = item.value();
+    }
+}
+
+/**
+ * @brief Serializes @a current as a patch against @a baseline.
+ *
+ * Both versions go through the reflection walk into json form and only
+ * the differing leaves survive, keyed by their dotted field paths.
+ */
+template <typename T>
+[[nodiscard]] json serialize_delta(const T& baseline, const T& current)
+{
+    json baseline_archive;
+    json current_archive;
+    serialization::save(baseline_archive, baseline);
+    serialization::save(current_archive, current);
+    return make_patch(baseline_archive, current_archive);
+}
+
+/**
+ * @brief Patch loader: updates @a object with the leaves in @a patch.
+ *
+ * The object supplies its own baseline — it is re-serialized, patched,
+ * and loaded back — so only the patched members change value.
+ */
+template <typename T>
+void apply_delta(const json& patch, T& object)
+{
+    json archive;
+    serialization::save(archive, object);
+    apply_patch(archive, patch);
+    serialization::load(archive, object);
+}
+
+//-----------------------------------------------------------------------------
+// Registry registration helper with const-correctness
+//-----------------------------------------------------------------------------
+namespace detail
+{
+template <typename Archiver, typename T>
+void save_polymorphic(Archiver& archive, const T& obj)
+{
+    serialization::save(archive, obj);
+}
+
+template <typename Archiver, typename T>
+void load_polymorphic(Archiver& archive, T& obj)
+{
+    serialization::load(archive, obj);
+}
+}  // namespace detail
+
+template <typename Archiver, typename T>
+void register_serializer_impl(Archiver& archive, void* obj, bool load_obj)
+{
+    if (load_obj)
+    {
+        auto* obj_ptr       = static_cast<ptr_const<T>*>(obj);
+        auto  loaded_object = detail::make_loaded_shared<T>();
+        detail::load_polymorphic(archive, *loaded_object);
+        *obj_ptr = std::move(loaded_object);
+    }
+    else
+    {
+        const auto* obj_ptr = static_cast<const T*>(obj);
+        detail::save_polymorphic(archive, *obj_ptr);
+    }
+}
+
+//-----------------------------------------------------------------------------
+namespace impl
+{
+
+//-----------------------------------------------------------------------------
+// Bulk fast path detection for the binary archiver
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Element types with a bulk Push/Pop overload on multi_process_stream
+ */
+template <typename T>
+concept StreamBulkElement =
+    std::same_as<T, double> || std::same_as<T, float> || std::same_as<T, int> ||
+    std::same_as<T, short> || std::same_as<T, unsigned short> || std::same_as<T, char> ||
+    std::same_as<T, unsigned int> || std::same_as<T, unsigned char> || std::same_as<T, long> ||
+    std::same_as<T, unsigned long> || std::same_as<T, long long> ||
+    std::same_as<T, unsigned long long>;
+
+/**
+ * @brief Contiguous containers of bulk-capable elements serialized through
+ * the binary archiver, eligible for a single block Push/Pop instead of
+ * per-element dispatch.
+ */
+template <typename Archiver, typename C>
+concept BinaryBulkContainer =
+    std::same_as<std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+    ContiguousContainer<C> && StreamBulkElement<typename C::value_type> &&
+    requires(C c, std::size_t n) { c.resize(n); };
+
+//-----------------------------------------------------------------------------
+// Memcpy fast path for trivially-copyable reflectable types
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief True when the reflection tuple of T covers the whole object
+ * with scalar members and no padding, so the in-memory bytes are the
+ * serialized representation.
+ */
+template <typename T>
+constexpr bool memcpy_layout_compatible()
+{
+    constexpr auto nbProperties =
+        std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+
+    bool   scalar_members = nbProperties > 0;
+    size_t members_size   = 0;
+    for_sequence(
+        std::make_index_sequence<nbProperties>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            using property_type = std::decay_t<
+                decltype(std::get<I>(serialization::access::serializer::tuple<T>()))>;
+            if constexpr (is_reflection_empty_v<property_type>)
+            {
+                scalar_members = false;
+            }
+            else
+            {
+                using member_type = typename property_type::member_type;
+                scalar_members =
+                    scalar_members &&
+                    (std::is_arithmetic_v<member_type> || std::is_enum_v<member_type>);
+                members_size += sizeof(member_type);
+            }
+        });
+
+    // A size mismatch means padding (or unreflected members); copying
+    // raw bytes would leak indeterminate padding into the archive and
+    // break cross-build determinism, so such types stay on the
+    // member-by-member path.
+    return scalar_members && members_size == sizeof(T);
+}
+
+/**
+ * @brief Reflectable structs whose bytes can be written as one block:
+ * trivially copyable, all members reflected scalars, no padding.
+ */
+template <typename T>
+concept MemcpyableReflectable =
+    Reflectable<T> && std::is_trivially_copyable_v<T> && memcpy_layout_compatible<T>();
+
+/**
+ * @brief Reverses the byte order of every reflected member in place.
+ *
+ * Companion to the memcpy fast paths: a foreign-endian archive delivers
+ * the block with each member in the writer's byte order, so after the
+ * block copy the members are swapped individually using the reflection
+ * layout.
+ */
+template <typename T>
+void byte_swap_members(T& obj)
+{
+    constexpr auto nbProperties =
+        std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+    for_sequence(
+        std::make_index_sequence<nbProperties>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            constexpr auto property = std::get<I>(serialization::access::serializer::tuple<T>());
+            auto&          member   = obj.*(property.member());
+            member                  = byte_swap(member);
+        });
+}
+
+/**
+ * @brief Contiguous containers of memcpy-compatible reflectable elements
+ * serialized through the binary archiver: the whole container is one
+ * block write instead of a reflection walk per element.
+ */
+template <typename Archiver, typename C>
+concept BinaryPodContainer =
+    std::same_as<std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+    ContiguousContainer<C> && MemcpyableReflectable<typename C::value_type> &&
+    requires(C c, std::size_t n) { c.resize(n); };
+
+//-----------------------------------------------------------------------------
+// Schema fingerprint
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Compile-time fingerprint of a reflectable type's layout.
+ *
+ * Folds every reflected member's name, size and category into one
+ * FNV-1a-style hash. The binary archiver writes the fingerprint with the
+ * first class-name record of each type and verifies it once per type on
+ * load, so writer/reader layout drift — renamed, reordered, resized or
+ * retyped members — is caught at the first object instead of silently
+ * corrupting data.
+ */
+template <typename T>
+[[nodiscard]] constexpr uint64_t schema_fingerprint()
+{
+    constexpr uint64_t prime = 1099511628211ULL;
+    constexpr auto     nbProperties =
+        std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+
+    uint64_t hash = quarisma::fnv1a("schema:v1");
+#if SERIALIZATION_BINARY_OFFSET_ORDER
+    // Offset-ordered traversal (see save_plan) is a different positional
+    // wire layout; fold a marker in so archives written in declaration
+    // order fail the fingerprint check loudly instead of misloading.
+    hash ^= quarisma::fnv1a("order:offset");
+    hash *= prime;
+#endif
+    for_sequence(
+        std::make_index_sequence<nbProperties>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            using property_type = std::decay_t<
+                decltype(std::get<I>(serialization::access::serializer::tuple<T>()))>;
+            if constexpr (!is_reflection_empty_v<property_type>)
+            {
+                constexpr auto property =
+                    std::get<I>(serialization::access::serializer::tuple<T>());
+                using member_type = typename property_type::member_type;
+
+                hash ^= quarisma::fnv1a(property.name());
+                hash *= prime;
+                hash ^= sizeof(member_type);
+                hash *= prime;
+                hash ^= std::is_arithmetic_v<member_type> ? 1ULL
+                        : std::is_enum_v<member_type>     ? 2ULL
+                                                          : 3ULL;
+                hash *= prime;
+            }
+        });
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+// Bit-packed bool and optional presence flags (binary archiver)
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Number of members of T that the binary layout encodes as single
+ * bits: plain bools and the has_value flags of optionals.
+ */
+template <typename T>
+[[nodiscard]] constexpr size_t packed_flag_count()
+{
+    size_t count = 0;
+    for_sequence(
+        std::make_index_sequence<
+            std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            using property_type = std::decay_t<
+                decltype(std::get<I>(serialization::access::serializer::tuple<T>()))>;
+            if constexpr (!is_reflection_empty_v<property_type>)
+            {
+                using member_type = typename property_type::member_type;
+                if constexpr (std::is_same_v<member_type, bool> || OptionalLike<member_type>)
+                {
+                    ++count;
+                }
+            }
+        });
+    return count;
+}
+
+/**
+ * @brief Flag-packed object save for the binary archiver.
+ *
+ * The flat layout costs a tag byte plus a data byte per bool and the
+ * same again per optional presence flag, so wide sparse structs pay
+ * dozens of bytes of pure presence overhead each. Here the flags of all
+ * such members are gathered into one bitmask pushed ahead of the
+ * members, in reflection-tuple order; bool members then occupy no
+ * further bytes and optionals write only their value when present.
+ * Field-index recording keeps the flat layout because it needs every
+ * member slice to be independently decodable.
+ */
+template <typename T>
+void save_object_packed(serialization::multi_process_stream& archive, const T& obj)
+{
+    constexpr size_t flag_count = packed_flag_count<T>();
+
+    std::array<unsigned char, (flag_count + 7) / 8> flags{};
+    size_t                                          bit = 0;
+    for_sequence(
+        std::make_index_sequence<
+            std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            using property_type = std::decay_t<
+                decltype(std::get<I>(serialization::access::serializer::tuple<T>()))>;
+            if constexpr (!is_reflection_empty_v<property_type>)
+            {
+                constexpr auto p = std::get<I>(serialization::access::serializer::tuple<T>());
+                using member_type = typename property_type::member_type;
+                if constexpr (std::is_same_v<member_type, bool>)
+                {
+                    flags[bit / 8] |= static_cast<unsigned char>(obj.*(p.member())) << (bit % 8);
+                    ++bit;
+                }
+                else if constexpr (OptionalLike<member_type>)
+                {
+                    flags[bit / 8] |= static_cast<unsigned char>((obj.*(p.member())).has_value())
+                                      << (bit % 8);
+                    ++bit;
+                }
+            }
+        });
+    archive.Push(flags.data(), static_cast<unsigned int>(flags.size()));
+
+    for_sequence(
+        std::make_index_sequence<
+            std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            using property_type = std::decay_t<
+                decltype(std::get<I>(serialization::access::serializer::tuple<T>()))>;
+            if constexpr (!is_reflection_empty_v<property_type>)
+            {
+                constexpr auto p = std::get<I>(serialization::access::serializer::tuple<T>());
+                using member_type = typename property_type::member_type;
+                if constexpr (std::is_same_v<member_type, bool>)
+                {
+                    // Carried entirely by the bitmask.
+                }
+                else if constexpr (OptionalLike<member_type>)
+                {
+                    if (const auto& member = obj.*(p.member()); member.has_value())
+                    {
+                        serialization::save(archive, *member);
+                    }
+                }
+                else
+                {
+                    serialization::save(archive, obj.*(p.member()));
+                }
+            }
+        });
+}
+
+/**
+ * @brief Mirror of save_object_packed: restores the bitmask-carried
+ * flags and loads the remaining members in tuple order.
+ */
+template <typename T>
+void load_object_packed(serialization::multi_process_stream& archive, T& obj)
+{
+    constexpr size_t flag_count = packed_flag_count<T>();
+
+    std::array<unsigned char, (flag_count + 7) / 8> flags{};
+    auto*                                           data = flags.data();
+    auto                                            size = static_cast<unsigned int>(flags.size());
+    archive.Pop(data, size);
+
+    size_t bit = 0;
+    for_sequence(
+        std::make_index_sequence<
+            std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            using property_type = std::decay_t<
+                decltype(std::get<I>(serialization::access::serializer::tuple<T>()))>;
+            if constexpr (!is_reflection_empty_v<property_type>)
+            {
+                constexpr auto p = std::get<I>(serialization::access::serializer::tuple<T>());
+                using member_type = typename property_type::member_type;
+                if constexpr (std::is_same_v<member_type, bool>)
+                {
+                    obj.*(p.member()) = ((flags[bit / 8] >> (bit % 8)) & 1U) != 0U;
+                    ++bit;
+                }
+                else if constexpr (OptionalLike<member_type>)
+                {
+                    auto& member = obj.*(p.member());
+                    if (((flags[bit / 8] >> (bit % 8)) & 1U) != 0U)
+                    {
+                        typename member_type::value_type value;
+                        serialization::load(archive, value);
+                        member = std::move(value);
+                    }
+                    else
+                    {
+                        member = std::nullopt;
+                    }
+                    ++bit;
+                }
+                else
+                {
+                    serialization::load(archive, obj.*(p.member()));
+                }
+            }
+        });
+}
+
+//-----------------------------------------------------------------------------
+// Columnar (struct-of-arrays) JSON layout
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Containers eligible for the columnar JSON layout: sequential
+ * containers of reflectable values on the json archiver.
+ */
+template <typename Archiver, typename C>
+concept ColumnarJsonContainer =
+    std::same_as<std::remove_cv_t<Archiver>, json> && Container<C> &&
+    !AssociativeContainer<C> && Reflectable<typename C::value_type> &&
+    requires(C c, std::size_t n) { c.resize(n); };
+
+/**
+ * Writes the container as one object: a Size member and a Columns
+ * mapping of field name to value array, derived from the reflection
+ * tuple. Field names appear once per container instead of once per
+ * element, which is where large homogeneous payloads spend their bytes.
+ */
+template <typename C>
+void save_container_columnar(json& archive, const C& container)
+{
+    using value_type = typename C::value_type;
+
+    archive[interned_key(SIZE_NAME)] = container.size();
+    auto& columns                    = archive[interned_key(COLUMNS_NAME)];
+
+    constexpr auto nbProperties =
+        std::tuple_size_v<decltype(serialization::access::serializer::tuple<value_type>())>;
+
+    for_sequence(
+        std::make_index_sequence<nbProperties>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            constexpr auto property =
+                std::get<I>(serialization::access::serializer::tuple<value_type>());
+
+            if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+            {
+                auto&  column = columns[interned_key(property.name())];
+                size_t i      = 0;
+                for (const auto& element : container)
+                {
+                    serialization::save(column[i++], element.*(property.member()));
+                }
+            }
+        });
+}
+
+/**
+ * Re-inflates a columnar object written by save_container_columnar.
+ */
+template <typename C>
+void load_container_columnar(json& archive, C& container)
+{
+    using value_type = typename C::value_type;
+
+    const auto size = archive[interned_key(SIZE_NAME)].get<size_t>();
+    container.resize(size);
+
+    auto& columns = archive[interned_key(COLUMNS_NAME)];
+
+    constexpr auto nbProperties =
+        std::tuple_size_v<decltype(serialization::access::serializer::tuple<value_type>())>;
+
+    for_sequence(
+        std::make_index_sequence<nbProperties>{},
+        [&]<auto I>(std::integral_constant<std::size_t, I>)
+        {
+            constexpr auto property =
+                std::get<I>(serialization::access::serializer::tuple<value_type>());
+
+            if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+            {
+                auto&  column = columns[interned_key(property.name())];
+                size_t i      = 0;
+                for (auto& element : container)
+                {
+                    serialization::load(column[i++], element.*(property.member()));
+                }
+            }
+        });
+
+    for (auto& element : container)
+    {
+        serialization::access::serializer::initialize(element);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Packed (base64) numeric container encoding
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Containers eligible for the packed base64 encoding: contiguous
+ * arithmetic element storage on the text archivers. long double is
+ * excluded because its width is platform-dependent.
+ */
+template <typename Archiver, typename C>
+concept PackedNumericContainer =
+    (std::same_as<std::remove_cv_t<Archiver>, json> ||
+     std::same_as<std::remove_cv_t<Archiver>, pugi::xml_node>) &&
+    ContiguousContainer<C> && std::is_arithmetic_v<typename C::value_type> &&
+    !std::same_as<typename C::value_type, bool> && sizeof(typename C::value_type) <= 8 &&
+    requires(C c, std::size_t n) { c.resize(n); };
+
+/**
+ * Encodes the container's element bytes as one base64 blob, normalized
+ * to little-endian so archives stay portable across hosts.
+ */
+template <typename C>
+[[nodiscard]] std::string packed_container_blob(const C& container)
+{
+    using value_type = typename C::value_type;
+
+    const auto*  bytes      = reinterpret_cast<const unsigned char*>(container.data());
+    const size_t byte_count = container.size() * sizeof(value_type);
+#ifdef SERIALIZATION_WORDS_BIGENDIAN
+    std::vector<unsigned char> swapped(bytes, bytes + byte_count);
+    byte_swap_array(reinterpret_cast<value_type*>(swapped.data()), container.size());
+    return base64_encode(swapped.data(), byte_count);
+#else
+    return base64_encode(bytes, byte_count);
+#endif
+}
+
+/**
+ * Decodes a blob produced by packed_container_blob back into the
+ * container; @a size is the element count recorded next to the blob.
+ */
+template <typename C>
+void unpack_container_blob(std::string_view blob, size_t size, C& container)
+{
+    using value_type = typename C::value_type;
+
+    std::vector<unsigned char> bytes;
+    const bool                 decoded = base64_decode(blob, bytes);
+    SERIALIZATION_CHECK(
+        decoded && bytes.size() == size * sizeof(value_type),
+        detail::serialization_error::error_code::size_mismatch,
+        "Packed container blob does not decode to {} elements",
+        size);
+
+    container.resize(size);
+    std::memcpy(container.data(), bytes.data(), bytes.size());
+#ifdef SERIALIZATION_WORDS_BIGENDIAN
+    byte_swap_array(container.data(), size);
+#endif
+}
+
+template <typename C>
+void save_container_packed(json& archive, const C& container)
+{
+    archive[interned_key(SIZE_NAME)]   = container.size();
+    archive[interned_key(PACKED_NAME)] = packed_container_blob(container);
+}
+
+template <typename C>
+void load_container_packed(json& archive, C& container)
+{
+    const auto size = archive[interned_key(SIZE_NAME)].get<size_t>();
+    const auto blob = archive[interned_key(PACKED_NAME)].get_ref<const std::string&>();
+    unpack_container_blob(blob, size, container);
+}
+
+template <typename C>
+void save_container_packed(pugi::xml_node& archive, const C& container)
+{
+    archive.append_attribute(interned_key(SIZE_NAME).c_str())
+        .set_value(static_cast<unsigned int>(container.size()));
+    archive.append_attribute(interned_key(PACKED_NAME).c_str()).set_value(true);
+    archive.text().set(packed_container_blob(container).c_str());
+}
+
+template <typename C>
+void load_container_packed(pugi::xml_node& archive, C& container)
+{
+    const auto size = static_cast<size_t>(
+        archive.attribute(interned_key(SIZE_NAME).c_str()).as_uint());
+    unpack_container_blob(archive.text().get(), size, container);
+}
+
+//-----------------------------------------------------------------------------
+// Container serialization - Sequential containers (C++20 concepts)
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Parallel JSON container load
+//-----------------------------------------------------------------------------
+/// Containers below this element count are never worth a worker pool.
+inline constexpr size_t parallel_load_min_elements = 1024;
+
+/**
+ * @brief Worker-pool element deserialization from a JSON array.
+ *
+ * Every element of the array is an independent subtree, so after one
+ * resize the workers claim index ranges off a shared ticket and load
+ * straight into their slots; nothing mutates the document or the
+ * container's structure, and the only synchronization is the join. The
+ * binary format has no per-element framing inline — its parallel story
+ * is the sectioned archive (serializer::binary_deserialize_sections).
+ */
+template <Container C>
+void load_container_parallel(json& archive, C& container, size_t workers)
+{
+    const size_t size = archiver_wrapper<json>::size(archive);
+    container.resize(size);
+
+    std::atomic<size_t> next{0};
+    constexpr size_t    chunk = 64;
+    const auto          work  = [&archive, &container, &next, size]()
+    {
+        while (true)
+        {
+            const size_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+            if (begin >= size)
+            {
+                break;
+            }
+            const size_t end = std::min(begin + chunk, size);
+            for (size_t i = begin; i < end; ++i)
+            {
+                serialization::load(archiver_wrapper<json>::get(archive, i), container[i]);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    const size_t             spawned = std::min(workers, (size + chunk - 1) / chunk);
+    pool.reserve(spawned);
+    for (size_t w = 0; w < spawned; ++w)
+    {
+        pool.emplace_back(work);
+    }
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+}
+
+template <typename Archiver, Container C>
+    requires(!AssociativeContainer<C>)
+void load_container(Archiver& archive, C& container)
+{
+    // A columnar object (see columnar_json_scope) re-inflates
+    // transparently; everything else is the ordinary array layout.
+    if constexpr (ColumnarJsonContainer<Archiver, C>)
+    {
+        if (archive.is_object() && archive.contains(interned_key(COLUMNS_NAME)))
+        {
+            load_container_columnar(archive, container);
+            return;
+        }
+    }
+
+    // Same for a packed record (see packed_numeric_scope).
+    if constexpr (PackedNumericContainer<Archiver, C>)
+    {
+        if constexpr (std::same_as<std::remove_cv_t<Archiver>, json>)
+        {
+            if (archive.is_object() && archive.contains(interned_key(PACKED_NAME)))
+            {
+                load_container_packed(archive, container);
+                return;
+            }
+        }
+        else
+        {
+            if (archive.attribute(interned_key(PACKED_NAME).c_str()))
+            {
+                load_container_packed(archive, container);
+                return;
+            }
+        }
+    }
+
+    const size_t size = archiver_wrapper<Archiver>::size(archive);
+
+    if constexpr (BinaryBulkContainer<Archiver, C>)
+    {
+        container.resize(size);
+        if (size > 0)
+        {
+            auto* data = container.data();
+            auto  n    = static_cast<unsigned int>(size);
+            archive.Pop(data, n);
+        }
+        return;
+    }
+
+    if constexpr (BinaryPodContainer<Archiver, C>)
+    {
+        container.resize(size);
+        if (size > 0)
+        {
+            auto* data = reinterpret_cast<unsigned char*>(container.data());
+            auto  n    = static_cast<unsigned int>(size * sizeof(typename C::value_type));
+            archive.Pop(data, n);
+            // A foreign-endian archive delivers the block with each
+            // element's members in the writer's byte order.
+            if (archive.needs_byte_swap()) [[unlikely]]
+            {
+                for (auto& element : container)
+                {
+                    byte_swap_members(element);
+                }
+            }
+            for (auto& element : container)
+            {
+                serialization::access::serializer::initialize(element);
+            }
+        }
+        return;
+    }
+
+    if constexpr (
+        std::same_as<std::remove_cv_t<Archiver>, json> && RandomAccessContainer<C> &&
+        EmplaceBackable<C> && DefaultConstructible<typename C::value_type> &&
+        requires(C& c, size_t n) { c.resize(n); })
+    {
+        if (auto* context = detail::active_context();
+            context != nullptr && context->parallel_load_workers > 1 &&
+            size >= parallel_load_min_elements && !context->track_shared_identity)
+        {
+            load_container_parallel(archive, container, context->parallel_load_workers);
+            return;
+        }
+    }
+
+    container.clear();
+
+    if constexpr (Reservable<C>)
+    {
+        container.reserve(size);
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        if constexpr (EmplaceBackable<C>)
+        {
+            auto& element = container.emplace_back();
+            serialization::load(archiver_wrapper<Archiver>::get(archive, i), element);
+        }
+        else
+        {
+            typename C::value_type item;
+            serialization::load(archiver_wrapper<Archiver>::get(archive, i), item);
+            container.insert(container.end(), std::move(item));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Parallel binary container save
+//-----------------------------------------------------------------------------
+/// Containers below this element count are never worth a worker pool.
+inline constexpr size_t parallel_save_min_elements = 1024;
+
+/**
+ * @brief Worker-pool element serialization for the binary archiver.
+ *
+ * The first element is written into @a archive directly, interning the
+ * element type's class name and schema. The remaining elements are split
+ * into chunks pulled off a shared ticket by a worker pool, each chunk
+ * serialized into a stream forked from the parent's write state, and the
+ * finished segments spliced back in element order — so the bytes are
+ * identical to a sequential save and the loader needs no changes. A
+ * chunk whose worker interned a name the fork did not know (first
+ * occurrence of a polymorphic derived type, say) cannot be spliced
+ * verbatim and is re-serialized into the parent instead; homogeneous
+ * containers never hit that path.
+ */
+template <Container C>
+void save_container_parallel(
+    serialization::multi_process_stream& archive, const C& container, size_t workers)
+{
+    using value_type = typename C::value_type;
+
+    const auto save_element =
+        [](serialization::multi_process_stream& stream, const value_type& element)
+    {
+        if constexpr (MapLike<C>)
+        {
+            serialization::save(stream, element.first);
+            serialization::save(stream, element.second);
+        }
+        else
+        {
+            serialization::save(stream, element);
+        }
+    };
+
+    // Element pointers give the workers random access into node-based
+    // containers; the collection pass is trivial next to serialization.
+    std::vector<const value_type*> elements;
+    elements.reserve(container.size());
+    for (const auto& item : container)
+    {
+        elements.push_back(&item);
+    }
+
+    save_element(archive, *elements.front());
+
+    const size_t remaining = elements.size() - 1;
+    const size_t chunks    = std::min(remaining, workers * 4);
+    const auto   chunk_begin = [remaining, chunks](size_t c) { return 1 + (remaining * c) / chunks; };
+    if (chunks <= 1)
+    {
+        for (size_t i = 1; i < elements.size(); ++i)
+        {
+            save_element(archive, *elements[i]);
+        }
+        return;
+    }
+
+    const size_t forked_names = archive.InternedNameCount();
+
+    std::vector<serialization::multi_process_stream> segments;
+    segments.reserve(chunks);
+    for (size_t c = 0; c < chunks; ++c)
+    {
+        segments.push_back(archive.ForkWriteState());
+    }
+
+    std::atomic<size_t> next{0};
+    const auto          work = [&elements, &segments, &next, &save_element, &chunk_begin, chunks]()
+    {
+        while (true)
+        {
+            const size_t c = next.fetch_add(1, std::memory_order_relaxed);
+            if (c >= chunks)
+            {
+                break;
+            }
+            const size_t end = chunk_begin(c + 1);
+            for (size_t i = chunk_begin(c); i < end; ++i)
+            {
+                save_element(segments[c], *elements[i]);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    const size_t             spawned = std::min(workers, chunks);
+    pool.reserve(spawned);
+    for (size_t w = 0; w < spawned; ++w)
+    {
+        pool.emplace_back(work);
+    }
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
+
+    for (size_t c = 0; c < chunks; ++c)
+    {
+        if (segments[c].InternedNameCount() == forked_names)
+        {
+            archive.AppendSegment(segments[c]);
+        }
+        else
+        {
+            const size_t end = chunk_begin(c + 1);
+            for (size_t i = chunk_begin(c); i < end; ++i)
+            {
+                save_element(archive, *elements[i]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief True when the active context asks for a parallel save of a
+ * container with @a size elements. Field-index recording needs the
+ * parent stream's byte offsets and stays sequential.
+ */
+[[nodiscard]] inline bool should_save_parallel(
+    const serialization::multi_process_stream& archive, size_t size)
+{
+    auto* context = detail::active_context();
+    return context != nullptr && context->parallel_save_workers > 1 &&
+           size >= parallel_save_min_elements && !archive.FieldIndexEnabled() &&
+           !context->track_shared_identity;
+}
 
 template <typename Archiver, Container C>
     requires(!AssociativeContainer<C>)
-void load_container(Archiver& archive, C& container)
+void save_container(Archiver& archive, const C& container)
 {
-    const size_t size = archiver_wrapper<Archiver>::size(archive);
+    if constexpr (ColumnarJsonContainer<Archiver, C>)
+    {
+        if (auto* context = detail::active_context();
+            context != nullptr && context->columnar_json)
+        {
+            save_container_columnar(archive, container);
+            return;
+        }
+    }
 
-    container.clear();
+    if constexpr (PackedNumericContainer<Archiver, C>)
+    {
+        if (auto* context = detail::active_context();
+            context != nullptr && context->packed_numeric)
+        {
+            save_container_packed(archive, container);
+            return;
+        }
+    }
 
-    if constexpr (Reservable<C>)
+    const size_t size = container.size();
+    if constexpr (is_json_emitter_v<Archiver>)
     {
-        container.reserve(size);
+        archive.begin_array();
     }
+    archiver_wrapper<Archiver>::resize(archive, size);
 
-    for (size_t i = 0; i < size; ++i)
+    if constexpr (BinaryBulkContainer<Archiver, C>)
     {
-        if constexpr (EmplaceBackable<C>)
+        if (size > 0)
         {
-            auto& element = container.emplace_back();
-            serialization::load(archiver_wrapper<Archiver>::get(archive, i), element);
+            archive.Push(container.data(), static_cast<unsigned int>(size));
         }
-        else
+        return;
+    }
+
+    if constexpr (BinaryPodContainer<Archiver, C>)
+    {
+        if (size > 0)
         {
-            typename C::value_type item;
-            serialization::load(archiver_wrapper<Archiver>::get(archive, i), item);
-            container.insert(container.end(), std::move(item));
+            archive.Push(
+                reinterpret_cast<const unsigned char*>(container.data()),
+                static_cast<unsigned int>(size * sizeof(typename C::value_type)));
         }
+        return;
     }
-}
 
-template <typename Archiver, Container C>
-    requires(!AssociativeContainer<C>)
-void save_container(Archiver& archive, const C& container)
-{
-    const size_t size = container.size();
-    archiver_wrapper<Archiver>::resize(archive, size);
+    if constexpr (std::is_same_v<std::remove_cv_t<Archiver>, serialization::multi_process_stream>)
+    {
+        if (should_save_parallel(archive, size))
+        {
+            save_container_parallel(archive, container, detail::active_context()->parallel_save_workers);
+            return;
+        }
+    }
 
     if constexpr (RandomAccessContainer<C>)
     {
@@ -297,6 +1924,15 @@ void save_container(Archiver& archive, const C& container)
             ++i;
         }
     }
+
+    if constexpr (is_json_emitter_v<Archiver>)
+    {
+        archive.end_array();
+    }
+    if constexpr (is_xml_emitter_v<Archiver>)
+    {
+        archive.end_element();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -330,7 +1966,21 @@ void load_associative_container(Archiver& archive, C& container)
             serialization::load(archiver_wrapper<Archiver>::get(archive, 2 * i), key);
             serialization::load(archiver_wrapper<Archiver>::get(archive, 2 * i + 1), value);
 
-            container.emplace(std::move(key), std::move(value));
+            if constexpr (OrderedAssociativeContainer<C>)
+            {
+                // save_associative_container wrote the elements in the
+                // container's iteration order, so appending with an end
+                // hint is amortized O(1) instead of a tree rebalancing
+                // per element. The hint is only advisory: a foreign
+                // archive that is not sorted still loads correctly, just
+                // at the ordinary logarithmic cost for the out-of-order
+                // elements.
+                container.emplace_hint(container.end(), std::move(key), std::move(value));
+            }
+            else
+            {
+                container.emplace(std::move(key), std::move(value));
+            }
         }
     }
     else  // SetLike
@@ -339,7 +1989,14 @@ void load_associative_container(Archiver& archive, C& container)
         {
             typename C::value_type value;
             serialization::load(archiver_wrapper<Archiver>::get(archive, i), value);
-            container.emplace(std::move(value));
+            if constexpr (OrderedAssociativeContainer<C>)
+            {
+                container.emplace_hint(container.end(), std::move(value));
+            }
+            else
+            {
+                container.emplace(std::move(value));
+            }
         }
     }
 }
@@ -349,6 +2006,22 @@ void save_associative_container(Archiver& archive, const C& container)
 {
     const size_t size = container.size();
 
+    if constexpr (is_json_emitter_v<Archiver>)
+    {
+        archive.begin_array();
+    }
+
+    if constexpr (std::is_same_v<std::remove_cv_t<Archiver>, serialization::multi_process_stream>)
+    {
+        if (should_save_parallel(archive, size))
+        {
+            archiver_wrapper<Archiver>::resize(archive, MapLike<C> ? 2 * size : size);
+            save_container_parallel(
+                archive, container, detail::active_context()->parallel_save_workers);
+            return;
+        }
+    }
+
     if constexpr (MapLike<C>)
     {
         archiver_wrapper<Archiver>::resize(archive, 2 * size);
@@ -370,8 +2043,222 @@ void save_associative_container(Archiver& archive, const C& container)
             serialization::save(archiver_wrapper<Archiver>::get(archive, i++), item);
         }
     }
+
+    if constexpr (is_json_emitter_v<Archiver>)
+    {
+        archive.end_array();
+    }
+    if constexpr (is_xml_emitter_v<Archiver>)
+    {
+        archive.end_element();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Per-(type, archiver) serialization plan
+//-----------------------------------------------------------------------------
+/**
+ * @brief Flat, type-erased member walk compiled once per (type, archiver).
+ *
+ * save_object/load_object used to re-expand for_sequence over the
+ * reflection tuple at every call site, inlining one save/load chain per
+ * member into the enclosing function. The plans fold that walk into a
+ * flat array of {name, op} steps built on first use and replayed as a
+ * tight loop over function pointers, which keeps the hot path in a small
+ * code footprint on polymorphic-heavy archives. Save and load plans are
+ * separate so save-only archivers (the streaming emitters) never
+ * instantiate load machinery.
+ */
+/**
+ * @brief Byte offset of a data member, read out of its pointer-to-member.
+ *
+ * The major ABIs (Itanium, MSVC) represent a data member pointer as the
+ * member's byte offset, which is all the traversal plans need for a
+ * sort key. An exotic representation would merely produce a different —
+ * still deterministic, still identical between save and load — order.
+ */
+template <typename Class, typename Member>
+[[nodiscard]] inline size_t member_pointer_offset(Member Class::* member) noexcept
+{
+    uint64_t offset = 0;
+    std::memcpy(
+        &offset, &member, sizeof(member) < sizeof(offset) ? sizeof(member) : sizeof(offset));
+    return static_cast<size_t>(offset);
 }
 
+template <typename Archiver, typename T>
+class save_plan
+{
+public:
+    struct step
+    {
+        field_name name;
+        void (*op)(Archiver&, const T&) = nullptr;
+        /// Member byte offset; sort key for the binary traversal order.
+        size_t offset = 0;
+    };
+
+    [[nodiscard]] static const save_plan& instance()
+    {
+        static const save_plan plan;
+        return plan;
+    }
+
+    [[nodiscard]] const step* begin() const { return steps_.data(); }
+    [[nodiscard]] const step* end() const { return steps_.data() + count_; }
+
+private:
+    static constexpr size_t capacity =
+        std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+
+    save_plan()
+    {
+        for_sequence(
+            std::make_index_sequence<capacity>{},
+            [&]<auto I>(std::integral_constant<std::size_t, I>)
+            {
+                constexpr auto property =
+                    std::get<I>(serialization::access::serializer::tuple<T>());
+
+                if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+                {
+                    steps_[count_++] = step{
+                        field_name{property.name()},
+                        [](Archiver& archive, const T& obj)
+                        {
+                            constexpr auto p =
+                                std::get<I>(serialization::access::serializer::tuple<T>());
+                            // Pre-hashed handle: archivers that key maps by
+                            // name reuse the compile-time hash.
+                            constexpr field_name key{p.name()};
+                            serialization::save(
+                                archiver_wrapper<Archiver>::get(archive, key),
+                                obj.*(p.member()));
+                        },
+                        member_pointer_offset(property.member())};
+                }
+            });
+
+#if SERIALIZATION_BINARY_OFFSET_ORDER
+        // Declaration order in the reflection tuple can differ wildly
+        // from memory layout; walking members front-to-back instead
+        // keeps container saves sequential per object so hardware
+        // prefetch does the work. Binary only: its field order is
+        // private to the format, while the text archivers keep the
+        // declaration order readers expect. load_plan sorts identically.
+        if constexpr (std::is_same_v<
+                          std::remove_cv_t<Archiver>, serialization::multi_process_stream>)
+        {
+            std::stable_sort(
+                steps_.begin(),
+                steps_.begin() + static_cast<std::ptrdiff_t>(count_),
+                [](const step& lhs, const step& rhs) { return lhs.offset < rhs.offset; });
+        }
+#endif
+    }
+
+    std::array<step, capacity> steps_{};
+    size_t                     count_ = 0;
+};
+
+template <typename Archiver, typename T>
+class load_plan
+{
+public:
+    struct step
+    {
+        field_name name;
+        /// Locates the field in the archive by name, then loads it.
+        void (*op)(Archiver&, T&) = nullptr;
+        /// Loads from an already-located field subtree; used by the
+        /// single-pass keyed dispatch in load_object.
+        void (*load_value)(Archiver&, T&) = nullptr;
+        /// Member byte offset; sort key for the binary traversal order.
+        size_t offset = 0;
+    };
+
+    [[nodiscard]] static const load_plan& instance()
+    {
+        static const load_plan plan;
+        return plan;
+    }
+
+    [[nodiscard]] const step* begin() const { return steps_.data(); }
+    [[nodiscard]] const step* end() const { return steps_.data() + count_; }
+
+    /// @brief Returns the step for @a name, or nullptr for foreign keys.
+    [[nodiscard]] const step* find(std::string_view name) const
+    {
+        const auto it = index_.find(name);
+        return it != index_.end() ? &steps_[it->second] : nullptr;
+    }
+
+private:
+    static constexpr size_t capacity =
+        std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+
+    load_plan()
+    {
+        for_sequence(
+            std::make_index_sequence<capacity>{},
+            [&]<auto I>(std::integral_constant<std::size_t, I>)
+            {
+                constexpr auto property =
+                    std::get<I>(serialization::access::serializer::tuple<T>());
+
+                if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+                {
+                    steps_[count_] = step{
+                        field_name{property.name()},
+                        [](Archiver& archive, T& obj)
+                        {
+                            constexpr auto p =
+                                std::get<I>(serialization::access::serializer::tuple<T>());
+                            using member_type = typename std::decay_t<decltype(p)>::member_type;
+                            constexpr field_name key{p.name()};
+                            serialization::load<Archiver, member_type>(
+                                archiver_wrapper<Archiver>::get(archive, key),
+                                obj.*(p.member()));
+                        },
+                        [](Archiver& field, T& obj)
+                        {
+                            constexpr auto p =
+                                std::get<I>(serialization::access::serializer::tuple<T>());
+                            using member_type = typename std::decay_t<decltype(p)>::member_type;
+                            serialization::load<Archiver, member_type>(field, obj.*(p.member()));
+                        },
+                        member_pointer_offset(property.member())};
+                    ++count_;
+                }
+            });
+
+#if SERIALIZATION_BINARY_OFFSET_ORDER
+        // Mirror of the save_plan sort: the binary format is positional,
+        // so the load walk must replay members in the same offset order
+        // they were written.
+        if constexpr (std::is_same_v<
+                          std::remove_cv_t<Archiver>, serialization::multi_process_stream>)
+        {
+            std::stable_sort(
+                steps_.begin(),
+                steps_.begin() + static_cast<std::ptrdiff_t>(count_),
+                [](const step& lhs, const step& rhs) { return lhs.offset < rhs.offset; });
+        }
+#endif
+
+        // The keyed-dispatch index is built after any reorder so it maps
+        // names to final step positions.
+        for (size_t i = 0; i < count_; ++i)
+        {
+            index_.emplace(std::string_view{steps_[i].name.name}, i);
+        }
+    }
+
+    std::array<step, capacity>                       steps_{};
+    quarisma::quarisma_map<std::string_view, size_t> index_;
+    size_t                                           count_ = 0;
+};
+
 //-----------------------------------------------------------------------------
 // Generic serializer implementation
 //-----------------------------------------------------------------------------
@@ -386,32 +2273,120 @@ struct serializer_impl
         if (obj == nullptr)
         {
             archiver_wrapper<Archiver>::push_class_name(archive, std::string(EMPTY_NAME));
+            if constexpr (is_json_emitter_v<Archiver>)
+            {
+                archive.end_object();
+            }
+            if constexpr (is_xml_emitter_v<Archiver>)
+            {
+                archive.end_element();
+            }
             return;
         }
 
+        // Depth guard: turns a runaway (cyclic, untracked) graph into an
+        // error instead of a stack overflow.
+        std::optional<detail::serialization_context::depth_guard> guard;
+        if (auto* context = detail::active_context(); context != nullptr)
+        {
+            guard.emplace(*context);
+        }
+
         constexpr auto nbProperties =
             std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
 
         const std::string& class_name = detail::polymorphic_type_name(obj);
         archiver_wrapper<Archiver>::push_class_name(archive, class_name);
+        detail::stats_count_object(class_name);
+
+        // The layout fingerprint travels with the first class-name record
+        // of each type; the loader verifies it before trusting the layout.
+        if constexpr (
+            std::is_same_v<std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+            nbProperties > 0)
+        {
+            archive.PushSchema(class_name, schema_fingerprint<T>());
+        }
+
+        // Padding-free scalar structs go out as one block write instead
+        // of a member-by-member reflection walk.
+        if constexpr (
+            std::is_same_v<std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+            MemcpyableReflectable<T>)
+        {
+            archive.Push(
+                reinterpret_cast<const unsigned char*>(obj),
+                static_cast<unsigned int>(sizeof(T)));
+            return;
+        }
+
+        // Sparse structs: bool members and optional presence flags go out
+        // as one leading bitmask instead of two bytes per flag.
+        if constexpr (
+            std::is_same_v<std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+            !MemcpyableReflectable<T>)
+        {
+            if constexpr (packed_flag_count<T>() > 0)
+            {
+                if (!archive.FieldIndexEnabled())
+                {
+                    save_object_packed(archive, *obj);
+                    return;
+                }
+            }
+        }
 
         if constexpr (nbProperties > 0)
         {
-            for_sequence(
-                std::make_index_sequence<nbProperties>{},
-                [&]<auto I>(std::integral_constant<std::size_t, I>)
+            constexpr bool is_binary =
+                std::is_same_v<std::remove_cv_t<Archiver>, serialization::multi_process_stream>;
+
+            // Delta save: with a dirty_fields_scope registered for this
+            // object, keyed archivers emit only the marked members. The
+            // binary layout is positional, so it always writes in full.
+            const dirty_mask* dirty = nullptr;
+            if constexpr (!is_binary)
+            {
+                if (auto* context = detail::active_context();
+                    context != nullptr && context->dirty_object == obj)
                 {
-                    constexpr auto property =
-                        std::get<I>(serialization::access::serializer::tuple<T>());
-                    const auto& name = property.name();
+                    dirty = context->dirty_fields;
+                }
+            }
 
-                    if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
-                    {
-                        const auto& member_ref = obj->*(property.member());
-                        serialization::save(archiver_wrapper<Archiver>::get(archive, name),
-                                            member_ref);
-                    }
-                });
+            size_t field = 0;
+            for (const auto& step : save_plan<Archiver, T>::instance())
+            {
+                if (const size_t index = field++; dirty != nullptr && !dirty->test(index))
+                {
+                    continue;
+                }
+                // Bracket the member so an enabled field index records
+                // its byte range (no-ops otherwise). The stats timer
+                // only records for the outermost field on the thread.
+                detail::stats_field_timer timer(step.name);
+                if constexpr (is_binary)
+                {
+                    archive.PushFieldScope(step.name);
+                }
+                step.op(archive, *obj);
+                if constexpr (is_binary)
+                {
+                    archive.PopFieldScope();
+                }
+            }
+        }
+
+        // The JSON emitter opened the object token in push_class_name and
+        // the XML emitter's element was opened by the enclosing get; close
+        // either now that the members are written.
+        if constexpr (is_json_emitter_v<Archiver>)
+        {
+            archive.end_object();
+        }
+        if constexpr (is_xml_emitter_v<Archiver>)
+        {
+            archive.end_element();
         }
     }
 
@@ -420,12 +2395,18 @@ struct serializer_impl
     //-------------------------------------------------------------------------
     static void load_object(Archiver& archive, T& obj)
     {
+        std::optional<detail::serialization_context::depth_guard> guard;
+        if (auto* context = detail::active_context(); context != nullptr)
+        {
+            guard.emplace(*context);
+        }
+
         constexpr auto nbProperties =
             std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
 
         if constexpr (nbProperties > 0)
         {
-            const auto class_name = archiver_wrapper<Archiver>::pop_class_name(archive);
+            const auto& class_name = archiver_wrapper<Archiver>::pop_class_name(archive);
 
             SERIALIZATION_CHECK(
                 !class_name.empty(),
@@ -434,23 +2415,101 @@ struct serializer_impl
 
             if (class_name != EMPTY_NAME)
             {
-                for_sequence(
-                    std::make_index_sequence<nbProperties>{},
-                    [&]<auto I>(std::integral_constant<std::size_t, I>)
+                detail::stats_count_object(class_name);
+
+                // Verify the writer's layout fingerprint before trusting
+                // the archive layout. The text archivers load fields by
+                // name, so drift is already tolerated there; the binary
+                // format has no names to fall back on, so a mismatch is
+                // an error rather than silent corruption.
+                if constexpr (std::is_same_v<
+                                  std::remove_cv_t<Archiver>, serialization::multi_process_stream>)
+                {
+                    if (!archive.PopSchema(class_name, schema_fingerprint<T>())) [[unlikely]]
+                    {
+                        SERIALIZATION_THROW(
+                            detail::serialization_error::error_code::schema_mismatch,
+                            "Schema fingerprint mismatch for '{}': the archive was "
+                            "written with a different layout of this type",
+                            class_name);
+                    }
+                }
+
+                if constexpr (
+                    std::is_same_v<
+                        std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+                    MemcpyableReflectable<T>)
+                {
+                    auto* data = reinterpret_cast<unsigned char*>(&obj);
+                    auto  n    = static_cast<unsigned int>(sizeof(T));
+                    archive.Pop(data, n);
+                    // A foreign-endian archive delivers the block with
+                    // each member in the writer's byte order.
+                    if (archive.needs_byte_swap()) [[unlikely]]
+                    {
+                        byte_swap_members(obj);
+                    }
+                    serialization::access::serializer::initialize(obj);
+                    return;
+                }
+
+                // Flag-packed layout (see save_object_packed): the leading
+                // bitmask carries bools and optional presence.
+                if constexpr (
+                    std::is_same_v<
+                        std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+                    !MemcpyableReflectable<T>)
+                {
+                    if constexpr (packed_flag_count<T>() > 0)
                     {
-                        constexpr auto property =
-                            std::get<I>(serialization::access::serializer::tuple<T>());
-                        const auto& name = property.name();
+                        if (!archive.FieldIndexEnabled())
+                        {
+                            load_object_packed(archive, obj);
+                            serialization::access::serializer::initialize(obj);
+                            return;
+                        }
+                    }
+                }
+
+                const auto& plan = load_plan<Archiver, T>::instance();
 
-                        if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+                // The keyed archivers locate fields by linear scan
+                // (nlohmann's ordered object, pugixml's sibling list), so
+                // one lookup per member made wide structs O(fields^2).
+                // Walk the archive's entries once instead and dispatch
+                // each to its step by name; fields may appear in any
+                // order, foreign keys are skipped, and absent members
+                // keep their current value.
+                if constexpr (std::is_same_v<std::remove_cv_t<Archiver>, json>)
+                {
+                    for (auto& item : archive.items())
+                    {
+                        if (const auto* step = plan.find(item.key()); step != nullptr)
                         {
-                            using member_type =
-                                typename std::decay_t<decltype(property)>::member_type;
-                            auto& member_ref = obj.*(property.member());
-                            serialization::load<Archiver, member_type>(
-                                archiver_wrapper<Archiver>::get(archive, name), member_ref);
+                            detail::stats_field_timer timer(item.key());
+                            step->load_value(item.value(), obj);
+                        }
+                    }
+                }
+                else if constexpr (std::is_same_v<std::remove_cv_t<Archiver>, pugi::xml_node>)
+                {
+                    for (pugi::xml_node child : archive.children())
+                    {
+                        if (const auto* step = plan.find(child.name()); step != nullptr)
+                        {
+                            detail::stats_field_timer timer(child.name());
+                            step->load_value(child, obj);
                         }
-                    });
+                    }
+                }
+                else
+                {
+                    for (const auto& step : plan)
+                    {
+                        detail::stats_field_timer timer(step.name);
+                        step.op(archive, obj);
+                    }
+                }
 
                 serialization::access::serializer::initialize(obj);
             }
@@ -539,6 +2598,12 @@ struct serializer_impl
 template <typename Archiver, typename Item, std::size_t Size>
 struct serializer_impl<Archiver, std::array<Item, Size>>
 {
+    // std::array has no resize, so the bulk eligibility check is done here
+    // instead of through BinaryBulkContainer.
+    static constexpr bool use_bulk_path =
+        std::same_as<std::remove_cv_t<Archiver>, serialization::multi_process_stream> &&
+        StreamBulkElement<Item>;
+
     static void load(Archiver& archive, std::array<Item, Size>& array)
     {
         const auto archive_size = archiver_wrapper<Archiver>::size(archive);
@@ -550,9 +2615,22 @@ struct serializer_impl<Archiver, std::array<Item, Size>>
             Size,
             archive_size);
 
-        for (size_t i = 0; i < Size; ++i)
+        if constexpr (use_bulk_path)
+        {
+            if constexpr (Size > 0)
+            {
+                auto* data = array.data();
+                auto  n    = static_cast<unsigned int>(Size);
+                archive.Pop(data, n);
+            }
+            return;
+        }
+        else
         {
-            serialization::load(archiver_wrapper<Archiver>::get(archive, i), array[i]);
+            for (size_t i = 0; i < Size; ++i)
+            {
+                serialization::load(archiver_wrapper<Archiver>::get(archive, i), array[i]);
+            }
         }
     }
 
@@ -560,9 +2638,19 @@ struct serializer_impl<Archiver, std::array<Item, Size>>
     {
         archiver_wrapper<Archiver>::resize(archive, Size);
 
-        for (size_t i = 0; i < Size; ++i)
+        if constexpr (use_bulk_path)
+        {
+            if constexpr (Size > 0)
+            {
+                archive.Push(array.data(), static_cast<unsigned int>(Size));
+            }
+        }
+        else
         {
-            serialization::save(archiver_wrapper<Archiver>::get(archive, i), array[i]);
+            for (size_t i = 0; i < Size; ++i)
+            {
+                serialization::save(archiver_wrapper<Archiver>::get(archive, i), array[i]);
+            }
         }
     }
 };
@@ -589,8 +2677,20 @@ struct serializer_impl<Archiver, std::variant<Types...>>
         std::visit(
             [&archive, index](const auto& object)
             {
+                if constexpr (is_json_emitter_v<Archiver>)
+                {
+                    archive.begin_object();
+                }
                 archiver_wrapper<Archiver>::push_index(archive, INDEX_NAME, index);
                 serialization::save(archiver_wrapper<Archiver>::get(archive, VALUE_NAME), object);
+                if constexpr (is_json_emitter_v<Archiver>)
+                {
+                    archive.end_object();
+                }
+                if constexpr (is_xml_emitter_v<Archiver>)
+                {
+                    archive.end_element();
+                }
             },
             variant);
     }
@@ -609,47 +2709,56 @@ struct serializer_impl<Archiver, std::variant<Types...>>
             index,
             num_types - 1);
 
-        using variant_type = std::variant<Types...>;
+        // Compile-time unrolled dispatch: a fold over the pack indices
+        // that the optimizer turns into a jump table. Unlike the previous
+        // static function-pointer table, each alternative's load stays
+        // inlineable at the dispatch site.
+        [&]<size_t... Is>(std::index_sequence<Is...>)
+        { ((index == Is ? load_alternative<Is>(archive, variant) : void()), ...); }(
+            std::make_index_sequence<num_types>{});
+    }
+
+private:
+    /**
+     * Loads alternative I directly in the variant's storage. A matching
+     * engaged alternative is reused and any other state is replaced via
+     * emplace, so the common default-constructible case costs one
+     * construction and no move. Non-default-constructible alternatives
+     * keep the staging buffer: they cannot be emplaced before their
+     * members are known.
+     */
+    template <size_t I>
+    static void load_alternative(Archiver& archive, std::variant<Types...>& variant)
+    {
+        using AltType = std::variant_alternative_t<I, std::variant<Types...>>;
 
-        // Helper to load a specific variant alternative
-        auto load_alternative = [&archive, &variant]<typename AltType>()
+        if constexpr (std::is_default_constructible_v<AltType>)
         {
-            if constexpr (std::is_default_constructible_v<AltType>)
+            if (variant.index() != I)
             {
-                if (!std::holds_alternative<AltType>(variant))
-                {
-                    variant = AltType{};
-                }
-                serialization::load(archiver_wrapper<Archiver>::get(archive, VALUE_NAME),
-                                    std::get<AltType>(variant));
+                variant.template emplace<I>();
             }
-            else
-            {
-                alignas(AltType) unsigned char storage[sizeof(AltType)];
-                auto*                          ptr =
-                    access::serializer::placement_new<AltType>(reinterpret_cast<void*>(storage));
+            serialization::load(
+                archiver_wrapper<Archiver>::get(archive, VALUE_NAME), std::get<I>(variant));
+        }
+        else
+        {
+            alignas(AltType) unsigned char storage[sizeof(AltType)];
+            auto*                          ptr =
+                access::serializer::placement_new<AltType>(reinterpret_cast<void*>(storage));
 
-                try
-                {
-                    serialization::load(archiver_wrapper<Archiver>::get(archive, VALUE_NAME), *ptr);
-                    variant = std::move(*ptr);
-                }
-                catch (...)
-                {
-                    access::serializer::destruct(*ptr);
-                    throw;
-                }
-                access::serializer::destruct(*ptr);
+            try
+            {
+                serialization::load(archiver_wrapper<Archiver>::get(archive, VALUE_NAME), *ptr);
+                variant = std::move(*ptr);
             }
-        };
-
-        // Dispatch to the correct loader based on index
-        using loader_type = void (*)(decltype(load_alternative)&, variant_type&);
-        static constexpr loader_type loaders[] = {
-            [](decltype(load_alternative)& loader, [[maybe_unused]] variant_type& v)
-            { loader.template operator()<Types>(); }...};
-
-        loaders[index](load_alternative, variant);
+            catch (...)
+            {
+                access::serializer::destruct(*ptr);
+                throw;
+            }
+            access::serializer::destruct(*ptr);
+        }
     }
 };
 
@@ -667,8 +2776,20 @@ struct serializer_impl<Archiver, std::pair<First, Second>>
 
     static void save(Archiver& archive, const std::pair<First, Second>& pair)
     {
+        if constexpr (is_json_emitter_v<Archiver>)
+        {
+            archive.begin_array();
+        }
         serialization::save(archiver_wrapper<Archiver>::get(archive, 0), pair.first);
         serialization::save(archiver_wrapper<Archiver>::get(archive, 1), pair.second);
+        if constexpr (is_json_emitter_v<Archiver>)
+        {
+            archive.end_array();
+        }
+        if constexpr (is_xml_emitter_v<Archiver>)
+        {
+            archive.end_element();
+        }
     }
 };
 
@@ -710,15 +2831,53 @@ struct serializer_impl<Archiver, T>
         if (!object)
         {
             archiver_wrapper<Archiver>::push_class_name(archive, std::string(EMPTY_NAME));
+            if constexpr (is_json_emitter_v<Archiver>)
+            {
+                archive.end_object();
+            }
+            if constexpr (is_xml_emitter_v<Archiver>)
+            {
+                archive.end_element();
+            }
             return;
         }
 
+        if (auto* context = detail::active_context();
+            context != nullptr && context->track_shared_identity)
+        {
+            const auto it = context->shared_saved.find(object.get());
+            if (it != context->shared_saved.end())
+            {
+                // Already written: emit a reference record instead of the
+                // object.
+                archiver_wrapper<Archiver>::push_class_name(
+                    archive, std::string(REFERENCE_NAME));
+                archiver_wrapper<Archiver>::push_index(archive, INDEX_NAME, it->second);
+                if constexpr (is_json_emitter_v<Archiver>)
+                {
+                    archive.end_object();
+                }
+                if constexpr (is_xml_emitter_v<Archiver>)
+                {
+                    archive.end_element();
+                }
+                return;
+            }
+            context->shared_saved.emplace(
+                object.get(), static_cast<unsigned int>(context->shared_saved.size()));
+        }
+
         if constexpr (Reflectable<element_type>)
         {
             // For reflectable types, write class name at shared_ptr level
-            // save_object will also write the class name for the object itself
-            const std::string& class_name = detail::polymorphic_type_name(object.get());
-            archiver_wrapper<Archiver>::push_class_name(archive, class_name);
+            // save_object will also write the class name for the object
+            // itself; the emitters write tokens in place, so they keep only
+            // the copy save_object emits.
+            if constexpr (!is_json_emitter_v<Archiver> && !is_xml_emitter_v<Archiver>)
+            {
+                const std::string& class_name = detail::polymorphic_type_name(object.get());
+                archiver_wrapper<Archiver>::push_class_name(archive, class_name);
+            }
 
             serialization::save(archive, *object);
         }
@@ -729,18 +2888,32 @@ struct serializer_impl<Archiver, T>
             archiver_wrapper<Archiver>::push_class_name(archive, class_name);
 
             using archiver_type = std::remove_cv_t<Archiver>;
-            if (archiver_wrapper<archiver_type>::registry()->Has(class_name))
+            detail::stats_count_registry_lookup();
+            if (const auto* function = archiver_wrapper<archiver_type>::registry()->find(class_name))
+            {
+                (*function)(archive, const_cast<element_type*>(object.get()), false);
+            }
+            if constexpr (is_xml_emitter_v<Archiver>)
             {
-                archiver_wrapper<archiver_type>::registry()->run(
-                    class_name, archive, const_cast<element_type*>(object.get()), false);
+                archive.end_element();
             }
         }
     }
 
     static void load(Archiver& archive, T& object)
     {
-        using archiver_type          = std::remove_cv_t<Archiver>;
-        const std::string class_name = archiver_wrapper<archiver_type>::pop_class_name(archive);
+        using archiver_type = std::remove_cv_t<Archiver>;
+
+        auto* context  = detail::active_context();
+        const bool tracking = context != nullptr && context->track_shared_identity;
+
+        // Stage the class name in the context arena when one is active so
+        // repeated pointer loads recycle one allocation instead of
+        // constructing a fresh std::string each.
+        std::string  local_name;
+        std::string& class_name =
+            context != nullptr ? context->arena.scratch_string() : local_name;
+        class_name = archiver_wrapper<archiver_type>::pop_class_name(archive);
 
         if (class_name == EMPTY_NAME)
         {
@@ -748,22 +2921,49 @@ struct serializer_impl<Archiver, T>
             return;
         }
 
-        if (archiver_wrapper<archiver_type>::registry()->Has(class_name))
+        if (tracking && class_name == REFERENCE_NAME)
         {
-            archiver_wrapper<archiver_type>::registry()->run(class_name, archive, &object, true);
+            // Back-reference: resolve against the already-loaded object so
+            // sharing semantics survive the round trip.
+            const auto id = archiver_wrapper<archiver_type>::pop_index(archive, INDEX_NAME);
+            object        = std::static_pointer_cast<element_type>(context->shared_loaded.at(id));
             return;
         }
 
-        if constexpr (Reflectable<element_type>)
+        // Reserve the identity slot before descending so ids match the
+        // encounter order used while saving.
+        size_t slot = 0;
+        if (tracking)
+        {
+            slot = context->shared_loaded.size();
+            context->shared_loaded.emplace_back();
+        }
+
+        detail::stats_count_registry_lookup();
+        if (const auto* function = archiver_wrapper<archiver_type>::registry()->find(class_name))
+        {
+            // One hash lookup resolves presence and the callback together.
+            (*function)(archive, &object, true);
+        }
+        else if constexpr (Reflectable<element_type>)
         {
             // Push the class name back since load_object will pop it again
             archiver_wrapper<archiver_type>::push_class_name(archive, class_name);
 
             using mutable_element_type = std::remove_const_t<element_type>;
-            auto loaded_object =
-                serialization::access::serializer::make_ptr<mutable_element_type>();
+            std::shared_ptr<mutable_element_type> loaded_object =
+                detail::make_loaded_shared<mutable_element_type>();
+            detail::stats_count_pointer_allocation();
+
+            // Publish the identity slot before descending so cyclic
+            // back-references inside the object resolve to it.
+            if (tracking)
+            {
+                context->shared_loaded[slot] = loaded_object;
+            }
+
             serialization::load(archive, *loaded_object);
-            object.reset(loaded_object.release());
+            object = loaded_object;
         }
         else
         {
@@ -772,6 +2972,12 @@ struct serializer_impl<Archiver, T>
                 "Cannot deserialize type '{}': not registered and no reflection available",
                 class_name);
         }
+
+        if (tracking && object)
+        {
+            context->shared_loaded[slot] = std::const_pointer_cast<void>(
+                std::static_pointer_cast<const void>(object));
+        }
     }
 };
 
@@ -814,8 +3020,20 @@ private:
     template <std::size_t... Is>
     static void save_tuple_impl(Archiver& archive, const T& tuple, std::index_sequence<Is...>)
     {
+        if constexpr (is_json_emitter_v<Archiver>)
+        {
+            archive.begin_array();
+        }
         (serialization::save(archiver_wrapper<Archiver>::get(archive, Is), std::get<Is>(tuple)),
          ...);
+        if constexpr (is_json_emitter_v<Archiver>)
+        {
+            archive.end_array();
+        }
+        if constexpr (is_xml_emitter_v<Archiver>)
+        {
+            archive.end_element();
+        }
     }
 };
 
@@ -831,6 +3049,11 @@ struct serializer_impl<Archiver, T>
     {
         const bool has_value = optional.has_value();
 
+        if constexpr (is_json_emitter_v<Archiver>)
+        {
+            archive.begin_array();
+        }
+
         // First, save whether the optional has a value
         archiver_wrapper<Archiver>::resize(archive, 2);
         serialization::save(archiver_wrapper<Archiver>::get(archive, 0), has_value);
@@ -840,6 +3063,15 @@ struct serializer_impl<Archiver, T>
         {
             serialization::save(archiver_wrapper<Archiver>::get(archive, 1), *optional);
         }
+
+        if constexpr (is_json_emitter_v<Archiver>)
+        {
+            archive.end_array();
+        }
+        if constexpr (is_xml_emitter_v<Archiver>)
+        {
+            archive.end_element();
+        }
     }
 
     static void load(Archiver& archive, T& optional)
@@ -877,6 +3109,159 @@ struct serializer_impl<Archiver, T>
 
 }  // namespace impl
 
+//-----------------------------------------------------------------------------
+// Binary archive size estimation
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Estimate the number of bytes an object will occupy in a binary
+ * archive (type tags included).
+ *
+ * Walks the same structure as save() but only accumulates sizes, so the
+ * result can be handed to multi_process_stream::Reserve before serializing
+ * to allocate the arena in one step. The estimate is exact for
+ * trivially-sized members, strings and containers of them; member kinds the
+ * walk does not understand contribute zero, so treat the result as an
+ * allocation hint rather than a guarantee.
+ */
+template <typename T>
+size_t estimate_binary_size(const T& obj)
+{
+    // One byte of type tag per value; sizes/indices are written as a tagged
+    // unsigned int.
+    constexpr size_t tag_size  = 1;
+    constexpr size_t size_size = tag_size + sizeof(unsigned int);
+
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        return tag_size + sizeof(int) + obj.size();
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+        return tag_size + sizeof(char);
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        return tag_size + sizeof(int);
+    }
+    else if constexpr (std::is_same_v<T, std::monostate>)
+    {
+        return tag_size + sizeof(unsigned char);
+    }
+    else if constexpr (std::is_arithmetic_v<T>)
+    {
+        return tag_size + sizeof(T);
+    }
+    else if constexpr (UniquePointer<T>)
+    {
+        return obj ? estimate_binary_size(*obj) : 0;
+    }
+    else if constexpr (SharedPointer<T>)
+    {
+        if (!obj)
+        {
+            return tag_size + sizeof(int) + EMPTY_NAME.size();
+        }
+        const std::string& name = detail::polymorphic_type_name(obj.get());
+        return tag_size + sizeof(int) + name.size() + estimate_binary_size(*obj);
+    }
+    else if constexpr (Reflectable<T>)
+    {
+        // Class-name record plus the schema fingerprint that travels with
+        // its first occurrence.
+        const std::string& name  = detail::polymorphic_type_name(&obj);
+        size_t             total = tag_size + sizeof(int) + name.size() + tag_size + sizeof(int64_t);
+
+        if constexpr (impl::MemcpyableReflectable<T>)
+        {
+            // Mirrors the block-write fast path: one tag, one length, raw bytes.
+            return total + tag_size + sizeof(unsigned int) + sizeof(T);
+        }
+
+        constexpr auto nbProperties =
+            std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+        if constexpr (nbProperties > 0)
+        {
+            for_sequence(
+                std::make_index_sequence<nbProperties>{},
+                [&]<auto I>(std::integral_constant<std::size_t, I>)
+                {
+                    constexpr auto property =
+                        std::get<I>(serialization::access::serializer::tuple<T>());
+                    if constexpr (!is_reflection_empty_v<std::decay_t<decltype(property)>>)
+                    {
+                        total += estimate_binary_size(obj.*(property.member()));
+                    }
+                });
+        }
+        return total;
+    }
+    else if constexpr (Container<T>)
+    {
+        size_t total = size_size;
+        if constexpr (MapLike<T>)
+        {
+            for (const auto& [key, value] : obj)
+            {
+                total += estimate_binary_size(key) + estimate_binary_size(value);
+            }
+        }
+        else if constexpr (impl::BinaryBulkContainer<serialization::multi_process_stream, T>)
+        {
+            // Mirrors the bulk Push fast path: one tag, one length, raw data.
+            total += tag_size + sizeof(unsigned int) + obj.size() * sizeof(typename T::value_type);
+        }
+        else if constexpr (impl::BinaryPodContainer<serialization::multi_process_stream, T>)
+        {
+            total += tag_size + sizeof(unsigned int) + obj.size() * sizeof(typename T::value_type);
+        }
+        else if constexpr (BaseSerializable<typename T::value_type> &&
+                           std::is_arithmetic_v<typename T::value_type>)
+        {
+            total += obj.size() * (tag_size + sizeof(typename T::value_type));
+        }
+        else
+        {
+            for (const auto& item : obj)
+            {
+                total += estimate_binary_size(item);
+            }
+        }
+        return total;
+    }
+    else if constexpr (OptionalLike<T>)
+    {
+        size_t total = size_size + tag_size + sizeof(char);
+        if (obj.has_value())
+        {
+            total += estimate_binary_size(*obj);
+        }
+        return total;
+    }
+    else if constexpr (VariantLike<T>)
+    {
+        return size_size +
+               std::visit([](const auto& value) { return estimate_binary_size(value); }, obj);
+    }
+    else if constexpr (TupleLike<T>)
+    {
+        size_t total = 0;
+        if constexpr (std::tuple_size_v<T> != 2 || !requires { obj.first; })
+        {
+            // std::pair is written without a size prefix; tuples carry one.
+            total += size_size;
+        }
+        std::apply(
+            [&total](const auto&... items) { ((total += estimate_binary_size(items)), ...); },
+            obj);
+        return total;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // Public API with concepts
 //-----------------------------------------------------------------------------
@@ -898,6 +3283,28 @@ void load(Archiver& archive, T& obj)
     impl::serializer_impl<Archiver, T>::load(archive, obj);
 }
 
+// Context-taking overloads: the context is installed for the duration of
+// the call (and picked up by the recursive walk through active_context),
+// enabling depth guarding and pointer-identity/cycle handling without
+// changing every serializer_impl signature.
+template <typename Archiver, typename T>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+void save(Archiver& archive, const T& obj, detail::serialization_context& context)
+{
+    detail::scoped_active_context scope(context);
+    impl::serializer_impl<Archiver, T>::save(archive, obj);
+}
+
+template <typename Archiver, typename T>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+void load(Archiver& archive, T& obj, detail::serialization_context& context)
+{
+    detail::scoped_active_context scope(context);
+    impl::serializer_impl<Archiver, T>::load(archive, obj);
+}
+
 // Rvalue reference overloads (for XML nodes returned by value)
 // Constrained to only match actual rvalues (not forwarding references)
 template <typename Archiver, typename T>
@@ -918,4 +3325,246 @@ void load(Archiver&& archive, T& obj)
     impl::serializer_impl<Archiver, T>::load(archive, obj);
 }
 
+// Value-returning overloads: `auto curve = serialization::load<T>(archive)`
+// materializes the result directly in the caller's storage (NRVO, a move
+// at worst), so callers no longer default-construct a throwaway object
+// and assign over it. Types that hide their default constructor behind
+// the reflection access hooks are constructed through them.
+template <typename T, typename Archiver>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+[[nodiscard]] T load(Archiver& archive)
+{
+    if constexpr (std::is_default_constructible_v<T>)
+    {
+        T obj{};
+        impl::serializer_impl<Archiver, T>::load(archive, obj);
+        return obj;
+    }
+    else
+    {
+        auto obj = serialization::access::serializer::make_ptr<T>();
+        impl::serializer_impl<Archiver, T>::load(archive, *obj);
+        return std::move(*obj);
+    }
+}
+
+template <typename T, typename Archiver>
+    requires(BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+[[nodiscard]] T load(Archiver& archive, detail::serialization_context& context)
+{
+    detail::scoped_active_context scope(context);
+    return serialization::load<T>(archive);
+}
+
+template <typename T, typename Archiver>
+    requires(!std::is_lvalue_reference_v<Archiver>) &&
+            (BaseSerializable<T> || Container<T> || Reflectable<T> || SmartPointer<T> ||
+             TupleLike<T> || VariantLike<T> || OptionalLike<T>)
+[[nodiscard]] T load(Archiver&& archive)
+{
+    return serialization::load<T>(archive);
+}
+
+//-----------------------------------------------------------------------------
+// Incremental (coroutine) binary serialization
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Slice budget for co_serialize: a slice ends when it reaches
+ * @a bytes or when @a time_slice has elapsed, whichever comes first.
+ */
+struct incremental_budget
+{
+    size_t                            bytes      = 64 * 1024;
+    std::chrono::steady_clock::duration time_slice = std::chrono::milliseconds(2);
+};
+
+/**
+ * @brief Handle to a suspended incremental serialization.
+ *
+ * Returned by co_serialize; each next() call resumes the coroutine for
+ * one budgeted slice and makes its bytes available through slice().
+ * Concatenating every slice yields SetRawData-compatible raw data (the
+ * final slice carries the endianness byte). The serialized object must
+ * outlive the handle.
+ */
+class incremental_save
+{
+public:
+    struct promise_type
+    {
+        std::span<const unsigned char> slice;
+        std::exception_ptr             error;
+
+        incremental_save get_return_object()
+        {
+            return incremental_save(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        std::suspend_always yield_value(std::span<const unsigned char> bytes) noexcept
+        {
+            slice = bytes;
+            return {};
+        }
+        void return_void() noexcept {}
+        void unhandled_exception() { error = std::current_exception(); }
+    };
+
+    incremental_save(incremental_save&& other) noexcept :
+        handle_(std::exchange(other.handle_, nullptr))
+    {
+    }
+
+    ~incremental_save()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    incremental_save(const incremental_save&)            = delete;
+    incremental_save& operator=(const incremental_save&) = delete;
+    incremental_save& operator=(incremental_save&&)      = delete;
+
+    /// @brief Serializes the next slice; false once the archive is complete.
+    bool next()
+    {
+        handle_.resume();
+        if (auto& error = handle_.promise().error; error)
+        {
+            std::rethrow_exception(error);
+        }
+        return !handle_.done();
+    }
+
+    /// @brief Bytes produced by the most recent next() call.
+    [[nodiscard]] std::span<const unsigned char> slice() const { return handle_.promise().slice; }
+
+private:
+    explicit incremental_save(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * @brief Serializes @a obj to the binary format in resumable slices.
+ *
+ * The coroutine suspends between container elements (and between the
+ * members of a top-level reflectable) whenever the running slice
+ * exceeds the byte or time budget, so an event loop can spread a large
+ * snapshot over many invisible turns instead of one stop-the-world
+ * pass. Suspension points exist at the granularity of the top-level
+ * walk; a single huge element still serializes within one slice. The
+ * bytes produced are identical to serialization::save into a fresh
+ * stream.
+ */
+template <typename T>
+incremental_save co_serialize(const T& obj, incremental_budget budget = {})
+{
+    using stream_t = serialization::multi_process_stream;
+
+    stream_t                   stream;
+    std::vector<unsigned char> pending;
+    stream.SetSink(
+        [&pending](const unsigned char* data, size_t size)
+        { pending.insert(pending.end(), data, data + size); },
+        static_cast<size_t>(-1));
+
+    auto       slice_start = std::chrono::steady_clock::now();
+    const auto over_budget = [&stream, &slice_start, budget]
+    {
+        return static_cast<size_t>(stream.Size()) >= budget.bytes ||
+               std::chrono::steady_clock::now() - slice_start >= budget.time_slice;
+    };
+
+    if constexpr (
+        Container<T> && !AssociativeContainer<T> &&
+        !impl::BinaryBulkContainer<stream_t, T> && !impl::BinaryPodContainer<stream_t, T>)
+    {
+        archiver_wrapper<stream_t>::resize(stream, obj.size());
+        for (const auto& element : obj)
+        {
+            serialization::save(stream, element);
+            if (over_budget())
+            {
+                stream.Flush();
+                co_yield std::span<const unsigned char>(pending);
+                pending.clear();
+                slice_start = std::chrono::steady_clock::now();
+            }
+        }
+    }
+    else if constexpr (AssociativeContainer<T>)
+    {
+        archiver_wrapper<stream_t>::resize(stream, MapLike<T> ? 2 * obj.size() : obj.size());
+        for (const auto& element : obj)
+        {
+            if constexpr (MapLike<T>)
+            {
+                serialization::save(stream, element.first);
+                serialization::save(stream, element.second);
+            }
+            else
+            {
+                serialization::save(stream, element);
+            }
+            if (over_budget())
+            {
+                stream.Flush();
+                co_yield std::span<const unsigned char>(pending);
+                pending.clear();
+                slice_start = std::chrono::steady_clock::now();
+            }
+        }
+    }
+    else if constexpr (Reflectable<T> && !impl::MemcpyableReflectable<T>)
+    {
+        // Mirrors save_object for the binary archiver: class-name record,
+        // schema fingerprint, then the member plan step by step.
+        const std::string& class_name = detail::polymorphic_type_name(&obj);
+        archiver_wrapper<stream_t>::push_class_name(stream, class_name);
+
+        constexpr auto nbProperties =
+            std::tuple_size_v<decltype(serialization::access::serializer::tuple<T>())>;
+        if constexpr (nbProperties > 0)
+        {
+            stream.PushSchema(class_name, impl::schema_fingerprint<T>());
+        }
+
+        // Flag-packed types (see save_object_packed) write a leading
+        // bitmask the plan steps know nothing about; emit their members
+        // in one go so the bytes match the sequential save.
+        if constexpr (impl::packed_flag_count<T>() > 0)
+        {
+            impl::save_object_packed(stream, obj);
+        }
+        else
+        {
+            for (const auto& step : impl::save_plan<stream_t, T>::instance())
+            {
+                step.op(stream, obj);
+                if (over_budget())
+                {
+                    stream.Flush();
+                    co_yield std::span<const unsigned char>(pending);
+                    pending.clear();
+                    slice_start = std::chrono::steady_clock::now();
+                }
+            }
+        }
+    }
+    else
+    {
+        serialization::save(stream, obj);
+    }
+
+    stream.Flush();
+    pending.push_back(stream.endianness());
+    co_yield std::span<const unsigned char>(pending);
+}
+
 }  // namespace serialization
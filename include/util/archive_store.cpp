@@ -0,0 +1,193 @@
+#include "util/archive_store.h"
+
+#include <cstring>
+#include <stdexcept>
+
+#include "util/byte_swap.h"
+
+namespace serialization
+{
+namespace
+{
+constexpr char   kStoreMagic[4] = {'S', 'A', 'R', '1'};
+constexpr size_t kHeaderBytes   = sizeof(kStoreMagic) + 1;
+
+unsigned char host_endianness()
+{
+    const uint16_t probe = 1;
+    unsigned char  first;
+    std::memcpy(&first, &probe, 1);
+    return first;
+}
+
+template <typename Word>
+void append_word(std::string& out, Word value)
+{
+    char bytes[sizeof(Word)];
+    std::memcpy(bytes, &value, sizeof(Word));
+    out.append(bytes, sizeof(Word));
+}
+
+template <typename Word>
+bool read_word(const unsigned char* data, size_t size, size_t& cursor, bool swap, Word& value)
+{
+    if (cursor + sizeof(Word) > size)
+    {
+        return false;
+    }
+    std::memcpy(&value, data + cursor, sizeof(Word));
+    cursor += sizeof(Word);
+    if (swap)
+    {
+        value = byte_swap(value);
+    }
+    return true;
+}
+}  // namespace
+
+//----------------------------------------------------------------------------
+archive_store::writer::writer(const std::string& path)
+    : out_(path, std::ios::binary | std::ios::trunc)
+{
+    out_.write(kStoreMagic, sizeof(kStoreMagic));
+    const char endianness = static_cast<char>(host_endianness());
+    out_.write(&endianness, 1);
+    offset_ = kHeaderBytes;
+}
+
+//----------------------------------------------------------------------------
+archive_store::writer::~writer()
+{
+    finish();
+}
+
+//----------------------------------------------------------------------------
+void archive_store::writer::add(std::string_view key, const std::vector<unsigned char>& payload)
+{
+    out_.write(
+        reinterpret_cast<const char*>(payload.data()),
+        static_cast<std::streamsize>(payload.size()));
+    entries_.push_back({std::string(key), offset_, payload.size()});
+    offset_ += payload.size();
+}
+
+//----------------------------------------------------------------------------
+void archive_store::writer::finish()
+{
+    if (finished_)
+    {
+        return;
+    }
+    finished_ = true;
+
+    // The table of contents trails the payloads, followed by its own
+    // byte count so a reader can seek to it from the end of the file.
+    std::string toc;
+    append_word(toc, static_cast<uint64_t>(entries_.size()));
+    for (const auto& entry : entries_)
+    {
+        append_word(toc, static_cast<uint32_t>(entry.key.size()));
+        toc.append(entry.key);
+        append_word(toc, entry.offset);
+        append_word(toc, entry.length);
+    }
+    append_word(toc, static_cast<uint64_t>(toc.size()));
+
+    out_.write(toc.data(), static_cast<std::streamsize>(toc.size()));
+    out_.flush();
+}
+
+//----------------------------------------------------------------------------
+archive_store::archive_store(const std::string& path) : mapping_(path)
+{
+    if (mapping_.data() != nullptr)
+    {
+        data_  = mapping_.data();
+        bytes_ = mapping_.size();
+    }
+    else
+    {
+        // Mapping unavailable (or empty file): fall back to a buffered
+        // read, the same policy as read_from_binary.
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in)
+        {
+            throw std::runtime_error("archive_store: cannot open file");
+        }
+        fallback_.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(
+            reinterpret_cast<char*>(fallback_.data()),
+            static_cast<std::streamsize>(fallback_.size()));
+        data_  = fallback_.data();
+        bytes_ = fallback_.size();
+    }
+
+    if (bytes_ < kHeaderBytes + sizeof(uint64_t) ||
+        std::memcmp(data_, kStoreMagic, sizeof(kStoreMagic)) != 0)
+    {
+        throw std::runtime_error("archive_store: file is not an archive store");
+    }
+    const bool swap = data_[sizeof(kStoreMagic)] != host_endianness();
+
+    uint64_t toc_size = 0;
+    {
+        size_t cursor = bytes_ - sizeof(uint64_t);
+        read_word(data_, bytes_, cursor, swap, toc_size);
+    }
+    if (toc_size > bytes_ - kHeaderBytes - sizeof(uint64_t))
+    {
+        throw std::runtime_error("archive_store: table of contents is truncated");
+    }
+
+    size_t         cursor = bytes_ - sizeof(uint64_t) - toc_size;
+    const size_t   limit  = bytes_ - sizeof(uint64_t);
+    uint64_t       count  = 0;
+    if (!read_word(data_, limit, cursor, swap, count))
+    {
+        throw std::runtime_error("archive_store: table of contents is truncated");
+    }
+
+    keys_.reserve(count);
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        uint32_t key_size = 0;
+        if (!read_word(data_, limit, cursor, swap, key_size) ||
+            cursor + key_size > limit)
+        {
+            throw std::runtime_error("archive_store: table of contents is truncated");
+        }
+        std::string key(reinterpret_cast<const char*>(data_) + cursor, key_size);
+        cursor += key_size;
+
+        uint64_t offset = 0;
+        uint64_t length = 0;
+        if (!read_word(data_, limit, cursor, swap, offset) ||
+            !read_word(data_, limit, cursor, swap, length) ||
+            offset + length > bytes_)
+        {
+            throw std::runtime_error("archive_store: table of contents is truncated");
+        }
+
+        index_[key] = {static_cast<size_t>(offset), static_cast<size_t>(length)};
+        keys_.push_back(std::move(key));
+    }
+}
+
+//----------------------------------------------------------------------------
+bool archive_store::contains(std::string_view key) const
+{
+    return index_.count(std::string(key)) != 0;
+}
+
+//----------------------------------------------------------------------------
+std::pair<const unsigned char*, size_t> archive_store::find(std::string_view key) const
+{
+    const auto it = index_.find(std::string(key));
+    if (it == index_.end())
+    {
+        return {nullptr, 0};
+    }
+    return {data_ + it->second.offset, it->second.length};
+}
+}  // namespace serialization
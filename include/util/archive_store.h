@@ -0,0 +1,135 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @class   archive_store
+ * @brief   Single-file store of named binary archives with a table of
+ *          contents.
+ *
+ * Deployments that write one archive file per object pay filesystem
+ * metadata for every record and thousands of opens on a cold load. An
+ * archive store packs named entries — each a complete standalone
+ * archive, trailing endianness byte included — back to back in one
+ * file: a "SAR1" header, the payloads in write order, then a table of
+ * contents of (key, offset, length) records and its trailing byte
+ * count. Writing is one open and sequential I/O; reading maps the file
+ * once, parses the TOC into a hash map, and serves each entry as a
+ * zero-copy view into the mapping.
+ *
+ * TOC words are written in the producer's byte order, recorded in the
+ * header's endianness byte and swapped on the fly when foreign; entry
+ * payloads carry their own endianness byte, as every archive does.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "util/export.h"
+#include "util/flat_hash.h"
+#include "util/memory_mapped_file.h"
+
+namespace serialization
+{
+class SERIALIZATION_API archive_store
+{
+public:
+    /**
+     * Batched writer: add entries in any order, then finish() (or let
+     * the destructor) append the table of contents. Keys must be
+     * unique; the last finish wins on duplicates only through the TOC
+     * parse order, so callers should not rely on it.
+     */
+    class SERIALIZATION_API writer
+    {
+    public:
+        explicit writer(const std::string& path);
+        ~writer();
+
+        writer(const writer&)            = delete;
+        writer& operator=(const writer&) = delete;
+
+        /**
+         * Appends one entry payload under @a key.
+         */
+        void add(std::string_view key, const std::vector<unsigned char>& payload);
+
+        /**
+         * Writes the table of contents and flushes; idempotent.
+         */
+        void finish();
+
+    private:
+        struct toc_entry
+        {
+            std::string key;
+            uint64_t    offset{0};
+            uint64_t    length{0};
+        };
+
+        std::ofstream          out_;
+        std::vector<toc_entry> entries_;
+        uint64_t               offset_{0};
+        bool                   finished_{false};
+    };
+
+    /**
+     * Opens @a path and parses the table of contents. Throws
+     * std::runtime_error when the file is missing or not a store.
+     */
+    explicit archive_store(const std::string& path);
+
+    archive_store(const archive_store&)            = delete;
+    archive_store& operator=(const archive_store&) = delete;
+
+    /**
+     * Whether an entry named @a key exists.
+     */
+    [[nodiscard]] bool contains(std::string_view key) const;
+
+    /**
+     * Bytes of the entry named @a key, viewed in place; empty when
+     * absent. The view shares the store's mapping and must not outlive
+     * it.
+     */
+    [[nodiscard]] std::pair<const unsigned char*, size_t> find(std::string_view key) const;
+
+    /**
+     * Entry keys in write order, for iteration.
+     */
+    [[nodiscard]] const std::vector<std::string>& keys() const { return keys_; }
+
+    [[nodiscard]] size_t size() const { return keys_.size(); }
+
+private:
+    struct span
+    {
+        size_t offset{0};
+        size_t length{0};
+    };
+
+    memory_mapped_file                       mapping_;
+    std::vector<unsigned char>               fallback_;
+    const unsigned char*                     data_{nullptr};
+    size_t                                   bytes_{0};
+    std::vector<std::string>                 keys_;
+    quarisma::quarisma_map<std::string, span> index_;
+};
+}  // namespace serialization
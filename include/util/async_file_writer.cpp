@@ -0,0 +1,91 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "util/async_file_writer.h"
+
+#include <fstream>
+#include <utility>
+
+namespace serialization
+{
+//----------------------------------------------------------------------------
+async_file_writer::async_file_writer(size_t max_pending)
+    : max_pending_(max_pending > 0 ? max_pending : 1), thread_(&async_file_writer::run, this)
+{
+}
+
+//----------------------------------------------------------------------------
+async_file_writer::~async_file_writer()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_available_.notify_all();
+    thread_.join();
+}
+
+//----------------------------------------------------------------------------
+void async_file_writer::enqueue(std::string path, std::vector<unsigned char> buffer)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_available_.wait(lock, [this] { return queue_.size() < max_pending_; });
+    queue_.push_back(job{std::move(path), std::move(buffer)});
+    lock.unlock();
+    work_available_.notify_one();
+}
+
+//----------------------------------------------------------------------------
+void async_file_writer::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    drained_.wait(lock, [this] { return queue_.empty() && !writing_; });
+}
+
+//----------------------------------------------------------------------------
+void async_file_writer::run()
+{
+    while (true)
+    {
+        job current;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_available_.wait(lock, [this] { return !queue_.empty() || stop_; });
+            if (queue_.empty())
+            {
+                return;
+            }
+            current = std::move(queue_.front());
+            queue_.pop_front();
+            writing_ = true;
+        }
+        space_available_.notify_one();
+
+        {
+            std::ofstream out(current.path.c_str(), std::ios::binary | std::ios::ate);
+            out.write(
+                reinterpret_cast<const char*>(current.buffer.data()),
+                static_cast<std::streamsize>(current.buffer.size()));
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            writing_ = false;
+        }
+        drained_.notify_all();
+    }
+}
+
+}  // namespace serialization
@@ -0,0 +1,89 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @file async_file_writer.h
+ * @brief Background writer thread with bounded double buffering.
+ *
+ * Snapshot writes used to block the producing thread for the duration of
+ * the disk write. The writer accepts ownership of a serialized buffer and
+ * returns immediately; a dedicated thread drains the queue in order. The
+ * queue depth is bounded (two buffers by default), so a producer that
+ * outruns the disk blocks on hand-off instead of growing memory without
+ * limit. flush() is the durability fence: it returns once every buffer
+ * enqueued before the call has reached its file.
+ */
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "util/export.h"
+
+namespace serialization
+{
+class SERIALIZATION_VISIBILITY async_file_writer
+{
+public:
+    explicit async_file_writer(size_t max_pending = 2);
+
+    /**
+     * Flushes outstanding writes and joins the writer thread.
+     */
+    ~async_file_writer();
+
+    async_file_writer(const async_file_writer&)            = delete;
+    async_file_writer& operator=(const async_file_writer&) = delete;
+    async_file_writer(async_file_writer&&)                 = delete;
+    async_file_writer& operator=(async_file_writer&&)      = delete;
+
+    /**
+     * Hands @a buffer off to the writer thread for writing to @a path.
+     * Returns as soon as the buffer is queued; blocks only when
+     * max_pending buffers are already waiting.
+     */
+    void enqueue(std::string path, std::vector<unsigned char> buffer);
+
+    /**
+     * Fence: blocks until every previously enqueued buffer is on disk.
+     */
+    void flush();
+
+private:
+    struct job
+    {
+        std::string                path;
+        std::vector<unsigned char> buffer;
+    };
+
+    void run();
+
+    std::deque<job>         queue_;
+    std::mutex              mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable space_available_;
+    std::condition_variable drained_;
+    size_t                  max_pending_;
+    bool                    writing_ = false;
+    bool                    stop_    = false;
+    std::thread             thread_;
+};
+
+}  // namespace serialization
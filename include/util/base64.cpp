@@ -0,0 +1,140 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "util/base64.h"
+
+#include <array>
+
+namespace serialization
+{
+namespace
+{
+constexpr char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+constexpr std::array<signed char, 256> build_reverse_table()
+{
+    std::array<signed char, 256> table{};
+    for (auto& entry : table)
+    {
+        entry = -1;
+    }
+    for (int i = 0; i < 64; ++i)
+    {
+        table[static_cast<unsigned char>(alphabet[i])] = static_cast<signed char>(i);
+    }
+    return table;
+}
+
+constexpr auto reverse_table = build_reverse_table();
+}  // namespace
+
+//----------------------------------------------------------------------------
+std::string base64_encode(const unsigned char* data, size_t size)
+{
+    std::string out;
+    out.reserve(((size + 2) / 3) * 4);
+
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3)
+    {
+        const unsigned int triple = (static_cast<unsigned int>(data[i]) << 16U) |
+                                    (static_cast<unsigned int>(data[i + 1]) << 8U) |
+                                    static_cast<unsigned int>(data[i + 2]);
+        out.push_back(alphabet[(triple >> 18U) & 0x3FU]);
+        out.push_back(alphabet[(triple >> 12U) & 0x3FU]);
+        out.push_back(alphabet[(triple >> 6U) & 0x3FU]);
+        out.push_back(alphabet[triple & 0x3FU]);
+    }
+
+    const size_t remainder = size - i;
+    if (remainder == 1)
+    {
+        const unsigned int triple = static_cast<unsigned int>(data[i]) << 16U;
+        out.push_back(alphabet[(triple >> 18U) & 0x3FU]);
+        out.push_back(alphabet[(triple >> 12U) & 0x3FU]);
+        out.push_back('=');
+        out.push_back('=');
+    }
+    else if (remainder == 2)
+    {
+        const unsigned int triple = (static_cast<unsigned int>(data[i]) << 16U) |
+                                    (static_cast<unsigned int>(data[i + 1]) << 8U);
+        out.push_back(alphabet[(triple >> 18U) & 0x3FU]);
+        out.push_back(alphabet[(triple >> 12U) & 0x3FU]);
+        out.push_back(alphabet[(triple >> 6U) & 0x3FU]);
+        out.push_back('=');
+    }
+    return out;
+}
+
+//----------------------------------------------------------------------------
+bool base64_decode(std::string_view text, std::vector<unsigned char>& out)
+{
+    if (text.size() % 4 != 0)
+    {
+        return false;
+    }
+    out.reserve(out.size() + (text.size() / 4) * 3);
+
+    for (size_t i = 0; i < text.size(); i += 4)
+    {
+        int          values[4];
+        unsigned int padding = 0;
+        for (size_t j = 0; j < 4; ++j)
+        {
+            const char character = text[i + j];
+            if (character == '=')
+            {
+                // Padding is only valid in the last one or two positions.
+                if (i + 4 != text.size() || j < 2)
+                {
+                    return false;
+                }
+                values[j] = 0;
+                ++padding;
+            }
+            else
+            {
+                if (padding > 0)
+                {
+                    return false;
+                }
+                const signed char value = reverse_table[static_cast<unsigned char>(character)];
+                if (value < 0)
+                {
+                    return false;
+                }
+                values[j] = value;
+            }
+        }
+
+        const unsigned int triple =
+            (static_cast<unsigned int>(values[0]) << 18U) |
+            (static_cast<unsigned int>(values[1]) << 12U) |
+            (static_cast<unsigned int>(values[2]) << 6U) | static_cast<unsigned int>(values[3]);
+        out.push_back(static_cast<unsigned char>((triple >> 16U) & 0xFFU));
+        if (padding < 2)
+        {
+            out.push_back(static_cast<unsigned char>((triple >> 8U) & 0xFFU));
+        }
+        if (padding < 1)
+        {
+            out.push_back(static_cast<unsigned char>(triple & 0xFFU));
+        }
+    }
+    return true;
+}
+
+}  // namespace serialization
@@ -0,0 +1,47 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @file base64.h
+ * @brief Base64 encoding of raw byte blocks.
+ *
+ * Used by the packed numeric container encoding: a contiguous arithmetic
+ * array is embedded in a JSON or XML document as one base64 blob of its
+ * little-endian bytes instead of one node per element.
+ */
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "util/export.h"
+
+namespace serialization
+{
+/**
+ * Encodes @a size bytes as standard base64 (RFC 4648, with padding).
+ */
+SERIALIZATION_VISIBILITY std::string base64_encode(const unsigned char* data, size_t size);
+
+/**
+ * Decodes a base64 string produced by base64_encode, appending the bytes
+ * to @a out. Returns false on malformed input.
+ */
+SERIALIZATION_VISIBILITY bool base64_decode(std::string_view text, std::vector<unsigned char>& out);
+
+}  // namespace serialization
@@ -0,0 +1,312 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#include "util/block_compression.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <thread>
+
+namespace serialization
+{
+namespace
+{
+// Compressed payloads are a sequence of two op kinds:
+//   0x00..0x7F: literal run, (op + 1) raw bytes follow (1..128)
+//   0x80..0xFF: match, length = (op & 0x7F) + min_match (4..131),
+//               followed by a little-endian u16 back-offset (1..65535)
+constexpr size_t min_match  = 4;
+constexpr size_t max_match  = 131;
+constexpr size_t max_offset = 65535;
+constexpr size_t hash_bits  = 14;
+
+inline uint32_t read32(const unsigned char* data)
+{
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(uint32_t));
+    return value;
+}
+
+inline uint32_t hash4(uint32_t value)
+{
+    return (value * 2654435761U) >> (32U - hash_bits);
+}
+
+inline void append_u16(std::vector<unsigned char>& out, size_t value)
+{
+    out.push_back(static_cast<unsigned char>(value & 0xFFU));
+    out.push_back(static_cast<unsigned char>((value >> 8U) & 0xFFU));
+}
+
+inline void append_u32(std::vector<unsigned char>& out, size_t value)
+{
+    out.push_back(static_cast<unsigned char>(value & 0xFFU));
+    out.push_back(static_cast<unsigned char>((value >> 8U) & 0xFFU));
+    out.push_back(static_cast<unsigned char>((value >> 16U) & 0xFFU));
+    out.push_back(static_cast<unsigned char>((value >> 24U) & 0xFFU));
+}
+
+inline size_t read_u32(const unsigned char* data)
+{
+    return static_cast<size_t>(data[0]) | (static_cast<size_t>(data[1]) << 8U) |
+           (static_cast<size_t>(data[2]) << 16U) | (static_cast<size_t>(data[3]) << 24U);
+}
+
+void flush_literals(
+    std::vector<unsigned char>& out, const unsigned char* data, size_t begin, size_t end)
+{
+    while (begin < end)
+    {
+        const size_t run = std::min<size_t>(end - begin, 128);
+        out.push_back(static_cast<unsigned char>(run - 1));
+        out.insert(out.end(), data + begin, data + begin + run);
+        begin += run;
+    }
+}
+}  // namespace
+
+//----------------------------------------------------------------------------
+size_t lz_compress(const unsigned char* data, size_t size, std::vector<unsigned char>& out)
+{
+    const size_t start = out.size();
+
+    // Last seen position of each 4-byte hash; greedy single-entry chain.
+    std::vector<uint32_t> table(size_t{1} << hash_bits, 0xFFFFFFFFU);
+
+    size_t pos           = 0;
+    size_t literal_begin = 0;
+    while (size >= min_match && pos + min_match <= size)
+    {
+        const uint32_t sequence  = read32(data + pos);
+        const uint32_t slot      = hash4(sequence);
+        const uint32_t candidate = table[slot];
+        table[slot]              = static_cast<uint32_t>(pos);
+
+        if (candidate != 0xFFFFFFFFU && pos - candidate <= max_offset &&
+            read32(data + candidate) == sequence)
+        {
+            size_t       length = min_match;
+            const size_t limit  = std::min(max_match, size - pos);
+            while (length < limit && data[candidate + length] == data[pos + length])
+            {
+                ++length;
+            }
+
+            flush_literals(out, data, literal_begin, pos);
+            out.push_back(static_cast<unsigned char>(0x80U | (length - min_match)));
+            append_u16(out, pos - candidate);
+
+            pos += length;
+            literal_begin = pos;
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+    flush_literals(out, data, literal_begin, size);
+
+    const size_t compressed = out.size() - start;
+    if (compressed >= size)
+    {
+        // Not worth it; let the caller store the block raw.
+        out.resize(start);
+        return 0;
+    }
+    return compressed;
+}
+
+//----------------------------------------------------------------------------
+bool lz_decompress(const unsigned char* data, size_t size, unsigned char* out, size_t raw_size)
+{
+    size_t in  = 0;
+    size_t pos = 0;
+    while (in < size)
+    {
+        const unsigned char op = data[in++];
+        if ((op & 0x80U) == 0)
+        {
+            const size_t run = static_cast<size_t>(op) + 1;
+            if (in + run > size || pos + run > raw_size)
+            {
+                return false;
+            }
+            std::memcpy(out + pos, data + in, run);
+            in += run;
+            pos += run;
+        }
+        else
+        {
+            const size_t length = static_cast<size_t>(op & 0x7FU) + min_match;
+            if (in + 2 > size || pos + length > raw_size)
+            {
+                return false;
+            }
+            const size_t offset =
+                static_cast<size_t>(data[in]) | (static_cast<size_t>(data[in + 1]) << 8U);
+            in += 2;
+            if (offset == 0 || offset > pos)
+            {
+                return false;
+            }
+            // Byte-by-byte: matches may overlap their own output.
+            for (size_t i = 0; i < length; ++i)
+            {
+                out[pos + i] = out[pos + i - offset];
+            }
+            pos += length;
+        }
+    }
+    return pos == raw_size;
+}
+
+//----------------------------------------------------------------------------
+void append_compressed_block(
+    std::vector<unsigned char>& out,
+    const unsigned char*        data,
+    size_t                      size,
+    compression_codec           codec)
+{
+    const size_t header = out.size();
+    out.push_back(static_cast<unsigned char>(codec));
+    append_u32(out, size);
+    append_u32(out, 0);
+
+    size_t stored = 0;
+    if (codec == compression_codec::lz)
+    {
+        stored = lz_compress(data, size, out);
+    }
+    if (stored == 0)
+    {
+        // Raw fallback (and the none codec): store the bytes verbatim.
+        out[header] = static_cast<unsigned char>(compression_codec::none);
+        out.insert(out.end(), data, data + size);
+        stored = size;
+    }
+
+    out[header + 5] = static_cast<unsigned char>(stored & 0xFFU);
+    out[header + 6] = static_cast<unsigned char>((stored >> 8U) & 0xFFU);
+    out[header + 7] = static_cast<unsigned char>((stored >> 16U) & 0xFFU);
+    out[header + 8] = static_cast<unsigned char>((stored >> 24U) & 0xFFU);
+}
+
+//----------------------------------------------------------------------------
+bool decompress_blocks(
+    const unsigned char*        data,
+    size_t                      size,
+    std::vector<unsigned char>& out,
+    size_t                      thread_count)
+{
+    struct block_ref
+    {
+        compression_codec codec;
+        size_t            stored_pos;
+        size_t            stored_size;
+        size_t            raw_pos;
+        size_t            raw_size;
+    };
+
+    // First pass: walk the frame headers to size the output and give each
+    // block an independent destination range.
+    std::vector<block_ref> blocks;
+    size_t                 pos      = 0;
+    size_t                 raw_total = 0;
+    while (pos < size)
+    {
+        if (pos + 9 > size)
+        {
+            return false;
+        }
+        block_ref block;
+        block.codec       = static_cast<compression_codec>(data[pos]);
+        block.raw_size    = read_u32(data + pos + 1);
+        block.stored_size = read_u32(data + pos + 5);
+        block.stored_pos  = pos + 9;
+        block.raw_pos     = raw_total;
+        if (block.stored_pos + block.stored_size > size ||
+            (block.codec != compression_codec::none && block.codec != compression_codec::lz))
+        {
+            return false;
+        }
+        raw_total += block.raw_size;
+        pos = block.stored_pos + block.stored_size;
+        blocks.push_back(block);
+    }
+
+    const size_t out_base = out.size();
+    out.resize(out_base + raw_total);
+
+    std::atomic<bool> ok{true};
+    const auto        decode_range = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const block_ref& block = blocks[i];
+            unsigned char*   dest  = out.data() + out_base + block.raw_pos;
+            if (block.codec == compression_codec::none)
+            {
+                if (block.stored_size != block.raw_size)
+                {
+                    ok.store(false, std::memory_order_relaxed);
+                    return;
+                }
+                std::memcpy(dest, data + block.stored_pos, block.stored_size);
+            }
+            else if (!lz_decompress(
+                         data + block.stored_pos, block.stored_size, dest, block.raw_size))
+            {
+                ok.store(false, std::memory_order_relaxed);
+                return;
+            }
+        }
+    };
+
+    const size_t workers = std::min(std::max<size_t>(thread_count, 1), blocks.size());
+    if (workers <= 1)
+    {
+        decode_range(0, blocks.size());
+    }
+    else
+    {
+        std::vector<std::thread> pool;
+        pool.reserve(workers);
+        const size_t chunk = (blocks.size() + workers - 1) / workers;
+        for (size_t w = 0; w < workers; ++w)
+        {
+            const size_t begin = w * chunk;
+            const size_t end   = std::min(begin + chunk, blocks.size());
+            if (begin < end)
+            {
+                pool.emplace_back(decode_range, begin, end);
+            }
+        }
+        for (auto& worker : pool)
+        {
+            worker.join();
+        }
+    }
+
+    if (!ok.load(std::memory_order_relaxed))
+    {
+        out.resize(out_base);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace serialization
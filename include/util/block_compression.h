@@ -0,0 +1,87 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @file block_compression.h
+ * @brief Block-based compression stage for binary archives.
+ *
+ * Archives are split into fixed-size blocks that compress independently,
+ * so compression can run while serialization is still producing chunks
+ * and decompression of a large file can be fanned out across threads.
+ * The codec is a self-contained byte-oriented LZ (greedy hash-chain
+ * matcher, 64 KiB window); blocks where it does not pay for itself are
+ * stored raw. Each block carries its own codec byte, so new codecs can
+ * be added without changing the frame layout.
+ *
+ * Block frame, repeated until end of stream:
+ *   u8 codec | u32 raw_size | u32 stored_size | stored_size bytes
+ * Sizes are little-endian on every platform.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "util/export.h"
+
+namespace serialization
+{
+enum class compression_codec : unsigned char
+{
+    none = 0,
+    lz   = 1
+};
+
+/**
+ * Compresses @a size bytes with the built-in LZ codec and appends the
+ * result to @a out. Returns the number of bytes appended; returns 0 when
+ * the compressed form would not be smaller than the input.
+ */
+SERIALIZATION_VISIBILITY size_t
+lz_compress(const unsigned char* data, size_t size, std::vector<unsigned char>& out);
+
+/**
+ * Decompresses an LZ payload produced by lz_compress into exactly
+ * @a raw_size bytes at @a out. Returns false on a malformed payload.
+ */
+SERIALIZATION_VISIBILITY bool
+lz_decompress(const unsigned char* data, size_t size, unsigned char* out, size_t raw_size);
+
+/**
+ * Appends one framed block holding @a size bytes to @a out. With the lz
+ * codec the block falls back to raw storage when compression does not
+ * shrink it, so framing never inflates the archive by more than the
+ * 9-byte block header.
+ */
+SERIALIZATION_VISIBILITY void append_compressed_block(
+    std::vector<unsigned char>& out,
+    const unsigned char*        data,
+    size_t                      size,
+    compression_codec           codec);
+
+/**
+ * Decodes a sequence of framed blocks, appending the reconstructed bytes
+ * to @a out. Blocks are independent, so with @a thread_count > 1 they
+ * are decompressed concurrently. Returns false on a malformed frame.
+ */
+SERIALIZATION_VISIBILITY bool decompress_blocks(
+    const unsigned char*        data,
+    size_t                      size,
+    std::vector<unsigned char>& out,
+    size_t                      thread_count = 1);
+
+}  // namespace serialization
@@ -0,0 +1,202 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @file byte_swap.h
+ * @brief Scalar and vectorized byte-order conversion kernels.
+ *
+ * Used by the binary archive path when the endianness byte recorded in a
+ * multi_process_stream differs from the host. The bulk kernels process
+ * whole arrays (SSSE3 pshufb / NEON vrev where available) with a scalar
+ * fallback, so multi-million-element double payloads are converted in
+ * 16-byte blocks instead of element by element.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "util/macros.h"
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace serialization
+{
+//----------------------------------------------------------------------------
+// Scalar kernels
+//----------------------------------------------------------------------------
+SERIALIZATION_FORCE_INLINE uint16_t byte_swap16(uint16_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ushort(value);
+#else
+    return __builtin_bswap16(value);
+#endif
+}
+
+SERIALIZATION_FORCE_INLINE uint32_t byte_swap32(uint32_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#else
+    return __builtin_bswap32(value);
+#endif
+}
+
+SERIALIZATION_FORCE_INLINE uint64_t byte_swap64(uint64_t value)
+{
+#if defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    return __builtin_bswap64(value);
+#endif
+}
+
+/**
+ * @brief Reverse the byte order of any trivially-copyable 1/2/4/8 byte value.
+ */
+template <typename T>
+SERIALIZATION_FORCE_INLINE T byte_swap(T value)
+{
+    static_assert(
+        sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+        "Unsupported value size for byte swapping");
+
+    if constexpr (sizeof(T) == 1)
+    {
+        return value;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        uint16_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits = byte_swap16(bits);
+        std::memcpy(&value, &bits, sizeof(bits));
+        return value;
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits = byte_swap32(bits);
+        std::memcpy(&value, &bits, sizeof(bits));
+        return value;
+    }
+    else
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits = byte_swap64(bits);
+        std::memcpy(&value, &bits, sizeof(bits));
+        return value;
+    }
+}
+
+//----------------------------------------------------------------------------
+// Bulk kernels
+//----------------------------------------------------------------------------
+namespace detail
+{
+template <size_t ElementSize>
+inline void byte_swap_block(unsigned char* data, size_t count)
+{
+    size_t i = 0;
+
+#if defined(__SSSE3__)
+    // pshufb reverses the bytes of each element in a 16-byte block.
+    const __m128i mask = []
+    {
+        if constexpr (ElementSize == 2)
+        {
+            return _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+        }
+        else if constexpr (ElementSize == 4)
+        {
+            return _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+        }
+        else
+        {
+            return _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+        }
+    }();
+
+    const size_t per_block = 16 / ElementSize;
+    for (; i + per_block <= count; i += per_block)
+    {
+        auto*   ptr   = reinterpret_cast<__m128i*>(data + i * ElementSize);
+        __m128i block = _mm_loadu_si128(ptr);
+        _mm_storeu_si128(ptr, _mm_shuffle_epi8(block, mask));
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const size_t per_block = 16 / ElementSize;
+    for (; i + per_block <= count; i += per_block)
+    {
+        uint8x16_t block = vld1q_u8(data + i * ElementSize);
+        if constexpr (ElementSize == 2)
+        {
+            block = vrev16q_u8(block);
+        }
+        else if constexpr (ElementSize == 4)
+        {
+            block = vrev32q_u8(block);
+        }
+        else
+        {
+            block = vrev64q_u8(block);
+        }
+        vst1q_u8(data + i * ElementSize, block);
+    }
+#endif
+
+    // Scalar tail (and full fallback when no vector unit is available).
+    for (; i < count; ++i)
+    {
+        unsigned char* element = data + i * ElementSize;
+        for (size_t lo = 0, hi = ElementSize - 1; lo < hi; ++lo, --hi)
+        {
+            const unsigned char tmp = element[lo];
+            element[lo]             = element[hi];
+            element[hi]             = tmp;
+        }
+    }
+}
+}  // namespace detail
+
+/**
+ * @brief Reverse the byte order of every element of an array in place.
+ */
+template <typename T>
+inline void byte_swap_array(T* data, size_t count)
+{
+    static_assert(
+        sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+        "Unsupported element size for byte swapping");
+
+    if constexpr (sizeof(T) > 1)
+    {
+        detail::byte_swap_block<sizeof(T)>(reinterpret_cast<unsigned char*>(data), count);
+    }
+}
+}  // namespace serialization
@@ -28,6 +28,38 @@
 #define HAS_DEMANGLE 0
 #endif
 
+// Hot-path instrumentation. Define SERIALIZATION_ENABLE_STATS=1 on the
+// compile line to record per-operation counters (bytes, objects by
+// class, registry lookups, time per top-level field); left at 0 the
+// hooks in util/serialization_stats.h compile to nothing.
+#ifndef SERIALIZATION_ENABLE_STATS
+#define SERIALIZATION_ENABLE_STATS 0
+#endif
+
+// Binary member traversal order. Left at 1, the per-type serialization
+// plans walk reflected members sorted by their byte offset, so saving a
+// container of objects reads each one front-to-back regardless of how
+// the reflection macro ordered them. This changes the (positional)
+// binary wire order, and the schema fingerprint carries a marker so
+// declaration-order archives are rejected rather than misread; define
+// SERIALIZATION_BINARY_OFFSET_ORDER=0 to keep declaration order and
+// read archives written before the switch. Text archivers always keep
+// declaration order.
+#ifndef SERIALIZATION_BINARY_OFFSET_ORDER
+#define SERIALIZATION_BINARY_OFFSET_ORDER 1
+#endif
+
+// Error handling mode. Left at 1, a failed SERIALIZATION_CHECK throws
+// serialization::detail::serialization_error. Define
+// SERIALIZATION_ENABLE_EXCEPTIONS=0 on the compile line to compile the
+// throw out: the first failure is recorded in a thread-local slot and
+// surfaced through the checked facade entry points
+// (binary_deserialize_checked), so intake paths fed malformed archives
+// never pay for exception unwinding.
+#ifndef SERIALIZATION_ENABLE_EXCEPTIONS
+#define SERIALIZATION_ENABLE_EXCEPTIONS 1
+#endif
+
 // Build configuration
 #ifdef NDEBUG
 #define SERIALIZATION_BUILD_RELEASE
@@ -15,13 +15,330 @@ limitations under the License.
 
 #pragma once
 
-#include <unordered_map>
+/**
+ * @file flat_hash.h
+ * @brief Open-addressing flat hash map behind the quarisma_map alias.
+ *
+ * The alias used to forward to std::unordered_map, so every registry and
+ * key-cache lookup chased node pointers. quarisma_map is now a linear
+ * probing, power-of-two flat table: entries live contiguously, probes
+ * touch adjacent memory, and string-like keys support heterogeneous
+ * std::string_view lookup so hot paths neither allocate nor copy.
+ *
+ * Keys and values must be default-constructible (slot storage is flat);
+ * pointers and iterators are invalidated by any insertion.
+ */
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace quarisma
 {
 
-// Simple alias for hash map - uses std::unordered_map
+/// FNV-1a over the bytes of a string-like key; used for both
+/// std::string and std::string_view so mixed lookups agree. constexpr
+/// so callers can precompute key hashes at compile time.
+[[nodiscard]] constexpr uint64_t fnv1a(std::string_view text)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char character : text)
+    {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+namespace detail
+{
+[[nodiscard]] inline size_t hash_bytes(std::string_view text)
+{
+    return static_cast<size_t>(fnv1a(text));
+}
+
+template <typename K>
+[[nodiscard]] size_t hash_key(const K& key)
+{
+    // Pre-hashed handles (serialization::field_name) carry their FNV-1a
+    // hash, computed at compile time; use it instead of re-hashing bytes.
+    if constexpr (requires {
+                      { key.hash } -> std::convertible_to<uint64_t>;
+                      std::string_view(key.name);
+                  })
+    {
+        return static_cast<size_t>(key.hash);
+    }
+    else if constexpr (std::is_convertible_v<const K&, std::string_view>)
+    {
+        return hash_bytes(std::string_view(key));
+    }
+    else
+    {
+        return std::hash<K>{}(key);
+    }
+}
+}  // namespace detail
+
+template <typename Key, typename Value>
+class flat_hash_map
+{
+    enum class slot_state : uint8_t
+    {
+        empty   = 0,
+        full    = 1,
+        erased  = 2,
+    };
+
+    using entry_type = std::pair<Key, Value>;
+
+public:
+    template <bool Const>
+    class basic_iterator
+    {
+        using map_type = std::conditional_t<Const, const flat_hash_map, flat_hash_map>;
+
+    public:
+        using value_type = std::conditional_t<Const, const entry_type, entry_type>;
+
+        basic_iterator() = default;
+        basic_iterator(map_type* map, size_t slot) : map_(map), slot_(slot) { skip_to_full(); }
+
+        value_type& operator*() const { return map_->entries_[slot_]; }
+        value_type* operator->() const { return &map_->entries_[slot_]; }
+
+        basic_iterator& operator++()
+        {
+            ++slot_;
+            skip_to_full();
+            return *this;
+        }
+
+        bool operator==(const basic_iterator& other) const { return slot_ == other.slot_; }
+        bool operator!=(const basic_iterator& other) const { return slot_ != other.slot_; }
+
+    private:
+        void skip_to_full()
+        {
+            while (map_ != nullptr && slot_ < map_->states_.size() &&
+                   map_->states_[slot_] != slot_state::full)
+            {
+                ++slot_;
+            }
+        }
+
+        map_type* map_  = nullptr;
+        size_t    slot_ = 0;
+    };
+
+    using iterator       = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    flat_hash_map() = default;
+
+    [[nodiscard]] size_t size() const { return size_; }
+    [[nodiscard]] bool   empty() const { return size_ == 0; }
+
+    void clear()
+    {
+        states_.assign(states_.size(), slot_state::empty);
+        for (auto& entry : entries_)
+        {
+            entry = entry_type{};
+        }
+        size_     = 0;
+        occupied_ = 0;
+    }
+
+    [[nodiscard]] iterator       begin() { return iterator(this, 0); }
+    [[nodiscard]] iterator       end() { return iterator(this, states_.size()); }
+    [[nodiscard]] const_iterator begin() const { return const_iterator(this, 0); }
+    [[nodiscard]] const_iterator end() const { return const_iterator(this, states_.size()); }
+
+    template <typename K>
+    [[nodiscard]] iterator find(const K& key)
+    {
+        const size_t slot = find_slot(key);
+        return slot != npos ? iterator(this, slot) : end();
+    }
+
+    template <typename K>
+    [[nodiscard]] const_iterator find(const K& key) const
+    {
+        const size_t slot = find_slot(key);
+        return slot != npos ? const_iterator(this, slot) : end();
+    }
+
+    template <typename K>
+    [[nodiscard]] size_t count(const K& key) const
+    {
+        return find_slot(key) != npos ? 1 : 0;
+    }
+
+    template <typename K>
+    [[nodiscard]] Value& at(const K& key)
+    {
+        const size_t slot = find_slot(key);
+        if (slot == npos)
+        {
+            throw std::out_of_range("flat_hash_map::at: key not found");
+        }
+        return entries_[slot].second;
+    }
+
+    template <typename K>
+    [[nodiscard]] const Value& at(const K& key) const
+    {
+        const size_t slot = find_slot(key);
+        if (slot == npos)
+        {
+            throw std::out_of_range("flat_hash_map::at: key not found");
+        }
+        return entries_[slot].second;
+    }
+
+    Value& operator[](const Key& key)
+    {
+        return entries_[insert_slot(key)].second;
+    }
+
+    template <typename K, typename V>
+    std::pair<iterator, bool> emplace(K&& key, V&& value)
+    {
+        const size_t before = size_;
+        const size_t slot   = insert_slot(Key(std::forward<K>(key)));
+        const bool   fresh  = size_ != before;
+        if (fresh)
+        {
+            entries_[slot].second = std::forward<V>(value);
+        }
+        return {iterator(this, slot), fresh};
+    }
+
+    template <typename K>
+    size_t erase(const K& key)
+    {
+        const size_t slot = find_slot(key);
+        if (slot == npos)
+        {
+            return 0;
+        }
+        states_[slot]  = slot_state::erased;
+        entries_[slot] = entry_type{};
+        --size_;
+        return 1;
+    }
+
+private:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    template <typename K>
+    [[nodiscard]] size_t find_slot(const K& key) const
+    {
+        if (states_.empty())
+        {
+            return npos;
+        }
+
+        const size_t mask = states_.size() - 1;
+        size_t       slot = detail::hash_key(key) & mask;
+        for (;;)
+        {
+            if (states_[slot] == slot_state::empty)
+            {
+                return npos;
+            }
+            if (states_[slot] == slot_state::full && entries_[slot].first == key)
+            {
+                return slot;
+            }
+            slot = (slot + 1) & mask;
+        }
+    }
+
+    /// Returns the slot holding @a key, inserting a default value (and
+    /// growing the table) when absent.
+    size_t insert_slot(const Key& key)
+    {
+        if (states_.empty() || (occupied_ + 1) * 4 > states_.size() * 3)
+        {
+            grow();
+        }
+
+        const size_t mask   = states_.size() - 1;
+        size_t       slot   = detail::hash_key(key) & mask;
+        size_t       insert = npos;
+        for (;;)
+        {
+            if (states_[slot] == slot_state::empty)
+            {
+                break;
+            }
+            if (states_[slot] == slot_state::erased)
+            {
+                if (insert == npos)
+                {
+                    insert = slot;
+                }
+            }
+            else if (entries_[slot].first == key)
+            {
+                return slot;
+            }
+            slot = (slot + 1) & mask;
+        }
+
+        if (insert == npos)
+        {
+            insert = slot;
+            ++occupied_;
+        }
+        states_[insert]        = slot_state::full;
+        entries_[insert].first = key;
+        ++size_;
+        return insert;
+    }
+
+    void grow()
+    {
+        const size_t            capacity = states_.empty() ? 16 : states_.size() * 2;
+        std::vector<slot_state> states(capacity, slot_state::empty);
+        std::vector<entry_type> entries(capacity);
+
+        const size_t mask = capacity - 1;
+        for (size_t i = 0; i < states_.size(); ++i)
+        {
+            if (states_[i] != slot_state::full)
+            {
+                continue;
+            }
+            size_t slot = detail::hash_key(entries_[i].first) & mask;
+            while (states[slot] == slot_state::full)
+            {
+                slot = (slot + 1) & mask;
+            }
+            states[slot]  = slot_state::full;
+            entries[slot] = std::move(entries_[i]);
+        }
+
+        states_   = std::move(states);
+        entries_  = std::move(entries);
+        occupied_ = size_;
+    }
+
+    std::vector<slot_state> states_;
+    std::vector<entry_type> entries_;
+    size_t                  size_     = 0;
+    size_t                  occupied_ = 0;
+};
+
 template <typename Key, typename Value>
-using quarisma_map = std::unordered_map<Key, Value>;
+using quarisma_map = flat_hash_map<Key, Value>;
 
 }  // namespace quarisma
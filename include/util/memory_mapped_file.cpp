@@ -0,0 +1,136 @@
+#include "util/memory_mapped_file.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace serialization
+{
+//----------------------------------------------------------------------------
+memory_mapped_file::memory_mapped_file(const std::string& path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) == 0 || file_size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return;
+    }
+
+    data_           = static_cast<const unsigned char*>(view);
+    size_           = static_cast<size_t>(file_size.QuadPart);
+    file_handle_    = file;
+    mapping_handle_ = mapping;
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps its own reference to the file.
+    ::close(fd);
+
+    if (view == MAP_FAILED)
+    {
+        return;
+    }
+
+    data_ = static_cast<const unsigned char*>(view);
+    size_ = static_cast<size_t>(info.st_size);
+#endif
+}
+
+//----------------------------------------------------------------------------
+memory_mapped_file::~memory_mapped_file()
+{
+    release();
+}
+
+//----------------------------------------------------------------------------
+memory_mapped_file::memory_mapped_file(memory_mapped_file&& other) noexcept
+{
+    data_       = std::exchange(other.data_, nullptr);
+    size_       = std::exchange(other.size_, 0);
+#ifdef _WIN32
+    file_handle_    = std::exchange(other.file_handle_, nullptr);
+    mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+}
+
+//----------------------------------------------------------------------------
+memory_mapped_file& memory_mapped_file::operator=(memory_mapped_file&& other) noexcept
+{
+    if (&other != this)
+    {
+        release();
+        data_       = std::exchange(other.data_, nullptr);
+        size_       = std::exchange(other.size_, 0);
+#ifdef _WIN32
+        file_handle_    = std::exchange(other.file_handle_, nullptr);
+        mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+    }
+    return (*this);
+}
+
+//----------------------------------------------------------------------------
+void memory_mapped_file::release()
+{
+    if (data_ == nullptr)
+    {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+    CloseHandle(mapping_handle_);
+    CloseHandle(file_handle_);
+    file_handle_    = nullptr;
+    mapping_handle_ = nullptr;
+#else
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+}  // namespace serialization
@@ -0,0 +1,72 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @class   memory_mapped_file
+ * @brief   Read-only memory mapping of a file.
+ *
+ * Maps a whole file into the address space so archive bytes are read
+ * demand-paged straight out of the page cache, without an intermediate
+ * heap copy. Used by the binary deserialization path together with the
+ * borrowing overload of multi_process_stream::SetRawData.
+ *
+ * The mapping is released in the destructor; any pointer obtained from
+ * data() must not outlive the object. When mapping fails (missing file,
+ * empty file, unsupported platform) data() returns nullptr and callers
+ * are expected to fall back to a buffered read.
+ */
+
+#include <cstddef>
+#include <string>
+
+#include "util/export.h"
+
+namespace serialization
+{
+class SERIALIZATION_API memory_mapped_file
+{
+public:
+    explicit memory_mapped_file(const std::string& path);
+    ~memory_mapped_file();
+
+    memory_mapped_file(const memory_mapped_file&)            = delete;
+    memory_mapped_file& operator=(const memory_mapped_file&) = delete;
+    memory_mapped_file(memory_mapped_file&& other) noexcept;
+    memory_mapped_file& operator=(memory_mapped_file&& other) noexcept;
+
+    /**
+     * Pointer to the first mapped byte, or nullptr when the file could
+     * not be mapped.
+     */
+    const unsigned char* data() const { return data_; }
+
+    /**
+     * Size of the mapping in bytes; zero when the file could not be mapped.
+     */
+    size_t size() const { return size_; }
+
+private:
+    void release();
+
+    const unsigned char* data_{nullptr};
+    size_t               size_{0};
+#ifdef _WIN32
+    void* file_handle_{nullptr};
+    void* mapping_handle_{nullptr};
+#endif
+};
+}  // namespace serialization
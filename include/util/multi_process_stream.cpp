@@ -1,7 +1,11 @@
 #include "util/multi_process_stream.h"
 
 #include <cassert>
-#include <deque>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "util/byte_swap.h"
 
 namespace serialization
 {
@@ -26,9 +30,20 @@ multi_process_stream::~multi_process_stream()
 //----------------------------------------------------------------------------
 multi_process_stream::multi_process_stream(const multi_process_stream& other)
 {
-    internals_        = new multi_process_stream::serializationInternals();
-    internals_->data_ = other.internals_->data_;
-    endianness_       = other.endianness_;
+    // Copy the whole internal state, then fold a borrowed view or
+    // pending chunk list into the copy's own arena: a copy must own its
+    // bytes rather than alias memory whose lifetime is tied to the
+    // original's caller. (The streaming sink and source callbacks are
+    // shared with the original.)
+    internals_ = new multi_process_stream::serializationInternals(*other.internals_);
+    internals_->materialize();
+    endianness_              = other.endianness_;
+    schema_trusted_          = other.schema_trusted_;
+    varint_                  = other.varint_;
+    string_interning_        = other.string_interning_;
+    string_intern_threshold_ = other.string_intern_threshold_;
+    field_index_enabled_     = other.field_index_enabled_;
+    intern_name_count_       = other.intern_name_count_;
 }
 
 //----------------------------------------------------------------------------
@@ -36,22 +51,83 @@ multi_process_stream& multi_process_stream::operator=(const multi_process_stream
 {
     if (&other != this)
     {
-        internals_->data_ = other.internals_->data_;
-        endianness_       = other.endianness_;
+        // Same deep-copy policy as the copy constructor.
+        *internals_ = *other.internals_;
+        internals_->materialize();
+        endianness_              = other.endianness_;
+        schema_trusted_          = other.schema_trusted_;
+        varint_                  = other.varint_;
+        string_interning_        = other.string_interning_;
+        string_intern_threshold_ = other.string_intern_threshold_;
+        field_index_enabled_     = other.field_index_enabled_;
+        intern_name_count_       = other.intern_name_count_;
+    }
+    return (*this);
+}
+
+//----------------------------------------------------------------------------
+multi_process_stream::multi_process_stream(multi_process_stream&& other) noexcept
+{
+    // Steal the internals. The moved-from stream may only be destroyed or
+    // assigned to afterwards.
+    internals_               = other.internals_;
+    endianness_              = other.endianness_;
+    schema_trusted_          = other.schema_trusted_;
+    varint_                  = other.varint_;
+    string_interning_        = other.string_interning_;
+    string_intern_threshold_ = other.string_intern_threshold_;
+    field_index_enabled_     = other.field_index_enabled_;
+    intern_name_count_       = other.intern_name_count_;
+    other.internals_         = nullptr;
+}
+
+//----------------------------------------------------------------------------
+multi_process_stream& multi_process_stream::operator=(multi_process_stream&& other) noexcept
+{
+    if (&other != this)
+    {
+        delete internals_;
+        internals_               = other.internals_;
+        endianness_              = other.endianness_;
+        schema_trusted_          = other.schema_trusted_;
+        varint_                  = other.varint_;
+        string_interning_        = other.string_interning_;
+        string_intern_threshold_ = other.string_intern_threshold_;
+        field_index_enabled_     = other.field_index_enabled_;
+        intern_name_count_       = other.intern_name_count_;
+        other.internals_         = nullptr;
     }
     return (*this);
 }
 
+//----------------------------------------------------------------------------
+void multi_process_stream::Reserve(size_t bytes)
+{
+    internals_->data_.reserve(bytes);
+}
+
 //----------------------------------------------------------------------------
 void multi_process_stream::Reset()
 {
-    internals_->data_.clear();
+    internals_->clear();
+    internals_->intern_ids_.clear();
+    internals_->intern_names_.clear();
+    internals_->value_intern_counts_.clear();
+    internals_->value_intern_ids_.clear();
+    internals_->value_intern_names_.clear();
+    internals_->schemas_written_.clear();
+    internals_->schemas_read_.clear();
+    internals_->class_record_new_ = false;
+    internals_->field_path_.clear();
+    internals_->field_starts_.clear();
+    internals_->field_entries_.clear();
+    intern_name_count_ = 0;
 }
 
 //----------------------------------------------------------------------------
 int multi_process_stream::Size()
 {
-    return (static_cast<int>(internals_->data_.size()));
+    return (static_cast<int>(internals_->size()));
 }
 
 //----------------------------------------------------------------------------
@@ -62,15 +138,15 @@ int multi_process_stream::RawSize()
 //----------------------------------------------------------------------------
 bool multi_process_stream::Empty()
 {
-    return (internals_->data_.empty());
+    return (internals_->empty());
 }
 
 //----------------------------------------------------------------------------
 void multi_process_stream::Push(const double* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::double_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+    push_tag(serializationInternals::double_value);
+    push_size_field(size);
     internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(double) * size);
 }
 
@@ -78,8 +154,8 @@ void multi_process_stream::Push(const double* array, unsigned int size)
 void multi_process_stream::Push(const float* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::float_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+    push_tag(serializationInternals::float_value);
+    push_size_field(size);
     internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(float) * size);
 }
 
@@ -87,17 +163,35 @@ void multi_process_stream::Push(const float* array, unsigned int size)
 void multi_process_stream::Push(const int* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::int32_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+    push_tag(serializationInternals::int32_value);
+    push_size_field(size);
     internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(int) * size);
 }
 
+//----------------------------------------------------------------------------
+void multi_process_stream::Push(const short* array, unsigned int size)
+{
+    assert("pre: array is nullptr!" && (array != nullptr));
+    push_tag(serializationInternals::int16_value);
+    push_size_field(size);
+    internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(short) * size);
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Push(const unsigned short* array, unsigned int size)
+{
+    assert("pre: array is nullptr!" && (array != nullptr));
+    push_tag(serializationInternals::uint16_value);
+    push_size_field(size);
+    internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(unsigned short) * size);
+}
+
 //----------------------------------------------------------------------------
 void multi_process_stream::Push(const char* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::char_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+    push_tag(serializationInternals::char_value);
+    push_size_field(size);
     internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(char) * size);
 }
 
@@ -105,8 +199,8 @@ void multi_process_stream::Push(const char* array, unsigned int size)
 void multi_process_stream::Push(const unsigned int* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::uint32_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+    push_tag(serializationInternals::uint32_value);
+    push_size_field(size);
     internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(unsigned int) * size);
 }
 
@@ -114,50 +208,81 @@ void multi_process_stream::Push(const unsigned int* array, unsigned int size)
 void multi_process_stream::Push(const unsigned char* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::uchar_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+    push_tag(serializationInternals::uchar_value);
+    push_size_field(size);
     internals_->Push(array, size);
 }
 
 //----------------------------------------------------------------------------
-void multi_process_stream::Push(const int64_t* array, unsigned int size)
+void multi_process_stream::Push(const long* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::int64_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
-    internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(uint64_t) * size);
+    push_tag(serializationInternals::int64_value);
+    push_size_field(size);
+    if constexpr (sizeof(long) == sizeof(long long))
+    {
+        internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(long long) * size);
+    }
+    else
+    {
+        // 32-bit long: widen element-wise so the wire stays 8 bytes wide.
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            const auto wide = static_cast<long long>(array[i]);
+            internals_->Push(reinterpret_cast<const unsigned char*>(&wide), sizeof(wide));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Push(const unsigned long* array, unsigned int size)
+{
+    assert("pre: array is nullptr!" && (array != nullptr));
+    push_tag(serializationInternals::uint64_value);
+    push_size_field(size);
+    if constexpr (sizeof(unsigned long) == sizeof(unsigned long long))
+    {
+        internals_->Push(
+            reinterpret_cast<const unsigned char*>(array), sizeof(unsigned long long) * size);
+    }
+    else
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            const auto wide = static_cast<unsigned long long>(array[i]);
+            internals_->Push(reinterpret_cast<const unsigned char*>(&wide), sizeof(wide));
+        }
+    }
 }
 
 //----------------------------------------------------------------------------
-//void multi_process_stream::Push(const uint64_t* array, unsigned int size)
-//{
-//    assert("pre: array is nullptr!" && (array != nullptr));
-//    internals_->data_.push_back(serializationInternals::uint64_value);
-//    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
-//    internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(uint64_t) * size);
-//}
+void multi_process_stream::Push(const long long* array, unsigned int size)
+{
+    assert("pre: array is nullptr!" && (array != nullptr));
+    push_tag(serializationInternals::int64_value);
+    push_size_field(size);
+    internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(long long) * size);
+}
 
 //----------------------------------------------------------------------------
-void multi_process_stream::Push(const size_t* array, unsigned int size)
+void multi_process_stream::Push(const unsigned long long* array, unsigned int size)
 {
     assert("pre: array is nullptr!" && (array != nullptr));
-    internals_->data_.push_back(serializationInternals::size_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
-    internals_->Push(reinterpret_cast<const unsigned char*>(array), sizeof(size_t) * size);
+    push_tag(serializationInternals::uint64_value);
+    push_size_field(size);
+    internals_->Push(
+        reinterpret_cast<const unsigned char*>(array), sizeof(unsigned long long) * size);
 }
 
 //----------------------------------------------------------------------------
 void multi_process_stream::Pop(double*& array, unsigned int& size)
 {
-    assert(
-        "pre: stream data must be double" &&
-        internals_->data_.front() == serializationInternals::double_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::double_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate array
         array = new double[size];
@@ -165,29 +290,28 @@ void multi_process_stream::Pop(double*& array, unsigned int& size)
     }
     else
     {
-        unsigned int sz;
-
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
     // Pop the array data
     internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(double) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
 }
 
 //----------------------------------------------------------------------------
 void multi_process_stream::Pop(float*& array, unsigned int& size)
 {
-    assert(
-        "pre: stream data must be float" &&
-        internals_->data_.front() == serializationInternals::float_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::float_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate array
         array = new float[size];
@@ -195,29 +319,28 @@ void multi_process_stream::Pop(float*& array, unsigned int& size)
     }
     else
     {
-        unsigned int sz;
-
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
     // Pop the array data
     internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(float) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
 }
 
 //----------------------------------------------------------------------------
 void multi_process_stream::Pop(int*& array, unsigned int& size)
 {
-    assert(
-        "pre: stream data must be int" &&
-        internals_->data_.front() == serializationInternals::int32_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::int32_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate the array
         array = new int[size];
@@ -225,29 +348,86 @@ void multi_process_stream::Pop(int*& array, unsigned int& size)
     }
     else
     {
-        unsigned int sz;
-
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
     // Pop the array data
     internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(int) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Pop(short*& array, unsigned int& size)
+{
+    pop_tag(serializationInternals::int16_value);
+
+    if (array == nullptr)
+    {
+        // Get the size of the array
+        size = pop_size_field();
+
+        // Allocate the array
+        array = new short[size];
+        assert("ERROR: cannot allocate array" && (array != nullptr));
+    }
+    else
+    {
+        // Get the size of the array
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
+        assert("ERROR: input array size does not match size of data" && (sz == size));
+    }
+
+    // Pop the array data
+    internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(short) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Pop(unsigned short*& array, unsigned int& size)
+{
+    pop_tag(serializationInternals::uint16_value);
+
+    if (array == nullptr)
+    {
+        // Get the size of the array
+        size = pop_size_field();
+
+        // Allocate the array
+        array = new unsigned short[size];
+        assert("ERROR: cannot allocate array" && (array != nullptr));
+    }
+    else
+    {
+        // Get the size of the array
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
+        assert("ERROR: input array size does not match size of data" && (sz == size));
+    }
+
+    // Pop the array data
+    internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(unsigned short) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
 }
 
 //----------------------------------------------------------------------------
 void multi_process_stream::Pop(char*& array, unsigned int& size)
 {
-    assert(
-        "pre: stream data must be of type char" &&
-        internals_->data_.front() == serializationInternals::char_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::char_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate the array
         array = new char[size];
@@ -255,10 +435,8 @@ void multi_process_stream::Pop(char*& array, unsigned int& size)
     }
     else
     {
-        unsigned int sz;
-
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
@@ -269,15 +447,12 @@ void multi_process_stream::Pop(char*& array, unsigned int& size)
 //----------------------------------------------------------------------------
 void multi_process_stream::Pop(unsigned int*& array, unsigned int& size)
 {
-    assert(
-        "pre: stream data must be of type unsigned int" &&
-        internals_->data_.front() == serializationInternals::uint32_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::uint32_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate the array
         array = new unsigned int[size];
@@ -285,29 +460,28 @@ void multi_process_stream::Pop(unsigned int*& array, unsigned int& size)
     }
     else
     {
-        unsigned int sz;
-
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
     // Pop the array data
     internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(unsigned int) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
 }
 
 //----------------------------------------------------------------------------
 void multi_process_stream::Pop(unsigned char*& array, unsigned int& size)
 {
-    assert(
-        "pre: stream data must be of type unsigned char" &&
-        internals_->data_.front() == serializationInternals::uchar_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::uchar_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate the array
         array = new unsigned char[size];
@@ -315,10 +489,8 @@ void multi_process_stream::Pop(unsigned char*& array, unsigned int& size)
     }
     else
     {
-        unsigned int sz;
-
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
@@ -327,99 +499,159 @@ void multi_process_stream::Pop(unsigned char*& array, unsigned int& size)
 }
 
 //----------------------------------------------------------------------------
-void multi_process_stream::Pop(int64_t*& array, unsigned int& size)
+void multi_process_stream::Pop(long*& array, unsigned int& size)
+{
+    pop_tag(serializationInternals::int64_value);
+
+    if (array == nullptr)
+    {
+        // Get the size of the array
+        size = pop_size_field();
+
+        // Allocate the array
+        array = new long[size];
+        assert("ERROR: cannot allocate array" && (array != nullptr));
+    }
+    else
+    {
+        // Get the size of the array
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
+        assert("ERROR: input array size does not match size of data" && (sz == size));
+    }
+
+    if constexpr (sizeof(long) == sizeof(long long))
+    {
+        // Pop the array data
+        internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(long long) * size);
+        if (needs_byte_swap())
+        {
+            byte_swap_array(array, size);
+        }
+    }
+    else
+    {
+        // 32-bit long: the wire is 8 bytes wide, narrow element-wise.
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            long long wide = 0;
+            internals_->Pop(reinterpret_cast<unsigned char*>(&wide), sizeof(wide));
+            if (needs_byte_swap())
+            {
+                wide = byte_swap(wide);
+            }
+            array[i] = static_cast<long>(wide);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Pop(unsigned long*& array, unsigned int& size)
 {
-    assert(
-        "pre: stream data must be of type int64_t" &&
-        internals_->data_.front() == serializationInternals::int64_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::uint64_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate the array
-        array = new int64_t[size];
+        array = new unsigned long[size];
         assert("ERROR: cannot allocate array" && (array != nullptr));
     }
     else
     {
-        unsigned int sz;
+        // Get the size of the array
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
+        assert("ERROR: input array size does not match size of data" && (sz == size));
+    }
+
+    if constexpr (sizeof(unsigned long) == sizeof(unsigned long long))
+    {
+        // Pop the array data
+        internals_->Pop(
+            reinterpret_cast<unsigned char*>(array), sizeof(unsigned long long) * size);
+        if (needs_byte_swap())
+        {
+            byte_swap_array(array, size);
+        }
+    }
+    else
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            unsigned long long wide = 0;
+            internals_->Pop(reinterpret_cast<unsigned char*>(&wide), sizeof(wide));
+            if (needs_byte_swap())
+            {
+                wide = byte_swap(wide);
+            }
+            array[i] = static_cast<unsigned long>(wide);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Pop(long long*& array, unsigned int& size)
+{
+    pop_tag(serializationInternals::int64_value);
+
+    if (array == nullptr)
+    {
+        // Get the size of the array
+        size = pop_size_field();
 
+        // Allocate the array
+        array = new long long[size];
+        assert("ERROR: cannot allocate array" && (array != nullptr));
+    }
+    else
+    {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
     // Pop the array data
-    internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(int64_t) * size);
-}
-
-//----------------------------------------------------------------------------
-//void multi_process_stream::Pop(uint64_t*& array, unsigned int& size)
-//{
-//    assert(
-//        "pre: stream data must be of type uint64_t" &&
-//        internals_->data_.front() == serializationInternals::uint64_value);
-//    internals_->data_.pop_front();
-//
-//    if (array == nullptr)
-//    {
-//        // Get the size of the array
-//        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
-//
-//        // Allocate the array
-//        array = new uint64_t[size];
-//        assert("ERROR: cannot allocate array" && (array != nullptr));
-//    }
-//    else
-//    {
-//        unsigned int sz;
-//
-//        // Get the size of the array
-//        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
-//        assert("ERROR: input array size does not match size of data" && (sz == size));
-//    }
-//
-//    // Pop the array data
-//    internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(uint64_t) * size);
-//}
-
-//----------------------------------------------------------------------------
-void multi_process_stream::Pop(size_t*& array, unsigned int& size)
-{
-    assert(
-        "pre: stream data must be of type size_t" &&
-        internals_->data_.front() == serializationInternals::size_value);
-    internals_->data_.pop_front();
+    internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(long long) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Pop(unsigned long long*& array, unsigned int& size)
+{
+    pop_tag(serializationInternals::uint64_value);
 
     if (array == nullptr)
     {
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+        size = pop_size_field();
 
         // Allocate the array
-        array = new size_t[size];
+        array = new unsigned long long[size];
         assert("ERROR: cannot allocate array" && (array != nullptr));
     }
     else
     {
-        unsigned int sz;
-
         // Get the size of the array
-        internals_->Pop(reinterpret_cast<unsigned char*>(&sz), sizeof(unsigned int));
+        [[maybe_unused]] const unsigned int sz = pop_size_field();
         assert("ERROR: input array size does not match size of data" && (sz == size));
     }
 
     // Pop the array data
-    internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(size_t) * size);
+    internals_->Pop(reinterpret_cast<unsigned char*>(array), sizeof(unsigned long long) * size);
+    if (needs_byte_swap())
+    {
+        byte_swap_array(array, size);
+    }
 }
 
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(double value)
 {
-    internals_->data_.push_back(serializationInternals::double_value);
+    push_tag(serializationInternals::double_value);
     internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(double));
     return (*this);
 }
@@ -427,7 +659,7 @@ multi_process_stream& multi_process_stream::operator<<(double value)
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(float value)
 {
-    internals_->data_.push_back(serializationInternals::float_value);
+    push_tag(serializationInternals::float_value);
     internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(float));
     return (*this);
 }
@@ -435,7 +667,12 @@ multi_process_stream& multi_process_stream::operator<<(float value)
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(int value)
 {
-    internals_->data_.push_back(serializationInternals::int32_value);
+    push_tag(serializationInternals::int32_value);
+    if (varint_)
+    {
+        push_varint(zigzag_encode(value));
+        return (*this);
+    }
     internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(int));
     return (*this);
 }
@@ -443,15 +680,33 @@ multi_process_stream& multi_process_stream::operator<<(int value)
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(short value)
 {
-    internals_->data_.push_back(serializationInternals::int32_value);
+    push_tag(serializationInternals::int16_value);
+    if (varint_)
+    {
+        push_varint(zigzag_encode(value));
+        return (*this);
+    }
     internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(short));
     return (*this);
 }
 
+//----------------------------------------------------------------------------
+multi_process_stream& multi_process_stream::operator<<(unsigned short value)
+{
+    push_tag(serializationInternals::uint16_value);
+    if (varint_)
+    {
+        push_varint(value);
+        return (*this);
+    }
+    internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned short));
+    return (*this);
+}
+
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(char value)
 {
-    internals_->data_.push_back(serializationInternals::char_value);
+    push_tag(serializationInternals::char_value);
     internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(char));
     return (*this);
 }
@@ -460,7 +715,7 @@ multi_process_stream& multi_process_stream::operator<<(char value)
 multi_process_stream& multi_process_stream::operator<<(bool value)
 {
     auto v = static_cast<char>(value);
-    internals_->data_.push_back(serializationInternals::char_value);
+    push_tag(serializationInternals::char_value);
     internals_->Push(reinterpret_cast<unsigned char*>(&v), sizeof(char));
     return (*this);
 }
@@ -468,7 +723,12 @@ multi_process_stream& multi_process_stream::operator<<(bool value)
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(unsigned int value)
 {
-    internals_->data_.push_back(serializationInternals::uint32_value);
+    push_tag(serializationInternals::uint32_value);
+    if (varint_)
+    {
+        push_varint(value);
+        return (*this);
+    }
     internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned int));
     return (*this);
 }
@@ -476,32 +736,62 @@ multi_process_stream& multi_process_stream::operator<<(unsigned int value)
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(unsigned char value)
 {
-    internals_->data_.push_back(serializationInternals::uchar_value);
+    push_tag(serializationInternals::uchar_value);
     internals_->Push(&value, sizeof(unsigned char));
     return (*this);
 }
 
 //-----------------------------------------------------------------------------
-multi_process_stream& multi_process_stream::operator<<(int64_t value)
+multi_process_stream& multi_process_stream::operator<<(long value)
 {
-    internals_->data_.push_back(serializationInternals::int64_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(int64_t));
+    push_tag(serializationInternals::int64_value);
+    if (varint_)
+    {
+        push_varint(zigzag_encode(value));
+        return (*this);
+    }
+    const auto wide = static_cast<long long>(value);
+    internals_->Push(reinterpret_cast<const unsigned char*>(&wide), sizeof(wide));
+    return (*this);
+}
+
+//-----------------------------------------------------------------------------
+multi_process_stream& multi_process_stream::operator<<(unsigned long value)
+{
+    push_tag(serializationInternals::uint64_value);
+    if (varint_)
+    {
+        push_varint(value);
+        return (*this);
+    }
+    const auto wide = static_cast<unsigned long long>(value);
+    internals_->Push(reinterpret_cast<const unsigned char*>(&wide), sizeof(wide));
     return (*this);
 }
 
 //-----------------------------------------------------------------------------
-//multi_process_stream& multi_process_stream::operator<<(uint64_t value)
-//{
-//    internals_->data_.push_back(serializationInternals::uint64_value);
-//    internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(uint64_t));
-//    return (*this);
-//}
+multi_process_stream& multi_process_stream::operator<<(long long value)
+{
+    push_tag(serializationInternals::int64_value);
+    if (varint_)
+    {
+        push_varint(zigzag_encode(value));
+        return (*this);
+    }
+    internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(long long));
+    return (*this);
+}
 
 //-----------------------------------------------------------------------------
-multi_process_stream& multi_process_stream::operator<<(size_t value)
+multi_process_stream& multi_process_stream::operator<<(unsigned long long value)
 {
-    internals_->data_.push_back(serializationInternals::size_value);
-    internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(size_t));
+    push_tag(serializationInternals::uint64_value);
+    if (varint_)
+    {
+        push_varint(value);
+        return (*this);
+    }
+    internals_->Push(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned long long));
     return (*this);
 }
 
@@ -515,58 +805,70 @@ multi_process_stream& multi_process_stream::operator<<(const char* value)
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(const std::string& value)
 {
+    if (string_interning_ && !schema_trusted_ && !field_index_enabled_)
+    {
+        push_interned_string(value);
+        return (*this);
+    }
+
     // Find the real string size
     auto size = static_cast<int>(value.size());
 
     // Set the type
-    internals_->data_.push_back(serializationInternals::string_value);
+    push_tag(serializationInternals::string_value);
 
     // Set the string size
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(int));
+    push_size_field(static_cast<unsigned int>(size));
 
-    // Set the string content
-    for (int idx = 0; idx < size; idx++)
-    {
-        internals_->Push(reinterpret_cast<const unsigned char*>(&value[idx]), sizeof(char));
-    }
+    // Set the string content in one block
+    internals_->Push(reinterpret_cast<const unsigned char*>(value.data()), value.size());
     return (*this);
 }
 
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator<<(const std::string_view& value)
 {
+    if (string_interning_ && !schema_trusted_ && !field_index_enabled_)
+    {
+        push_interned_string(value);
+        return (*this);
+    }
+
     // Find the real string_view size
     auto size = static_cast<int>(value.size());
 
     // Set the type
-    internals_->data_.push_back(serializationInternals::string_value);
+    push_tag(serializationInternals::string_value);
 
     // Set the string_view size
-    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(int));
+    push_size_field(static_cast<unsigned int>(size));
 
-    // Set the string_view content
-    for (int idx = 0; idx < size; idx++)
-    {
-        internals_->Push(reinterpret_cast<const unsigned char*>(&value[idx]), sizeof(char));
-    }
+    // Set the string_view content in one block
+    internals_->Push(reinterpret_cast<const unsigned char*>(value.data()), value.size());
     return (*this);
 }
 
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator>>(double& value)
 {
-    assert(internals_->data_.front() == serializationInternals::double_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::double_value);
     internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(double));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
     return (*this);
 }
 
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator>>(float& value)
 {
-    assert(internals_->data_.front() == serializationInternals::float_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::float_value);
     internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(float));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
     return (*this);
 }
 
@@ -574,9 +876,26 @@ multi_process_stream& multi_process_stream::operator>>(float& value)
 multi_process_stream& multi_process_stream::operator>>(int& value)
 {
     value = 0;
-    assert(internals_->data_.front() == serializationInternals::int32_value);
-    internals_->data_.pop_front();
+    // Automatically narrow 64-bit records so archives written by a 64-bit
+    // producer load on a 32-bit consumer without a conversion shim.
+    if (!schema_trusted_ && internals_->front() == serializationInternals::int64_value)
+    {
+        long long value64 = 0;
+        (*this) >> value64;
+        value = static_cast<int>(value64);
+        return (*this);
+    }
+    pop_tag(serializationInternals::int32_value);
+    if (varint_)
+    {
+        value = static_cast<int>(zigzag_decode(pop_varint()));
+        return (*this);
+    }
     internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(int));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
     return (*this);
 }
 
@@ -585,24 +904,55 @@ multi_process_stream& multi_process_stream::operator>>(short& value)
 {
     // Automatically convert 64 bit values in case we are trying to transfer
     // int64_t with processes compiled with 32/64 values.
-    if (internals_->data_.front() == serializationInternals::int64_value)
+    if (!schema_trusted_ && internals_->front() == serializationInternals::int64_value)
     {
         int64_t value64;
         (*this) >> value64;
         value = static_cast<short>(value64);
         return (*this);
     }
-    assert(internals_->data_.front() == serializationInternals::int32_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::int16_value);
+    if (varint_)
+    {
+        value = static_cast<short>(zigzag_decode(pop_varint()));
+        return (*this);
+    }
     internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(short));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
+    return (*this);
+}
+
+//----------------------------------------------------------------------------
+multi_process_stream& multi_process_stream::operator>>(unsigned short& value)
+{
+    if (!schema_trusted_ && internals_->front() == serializationInternals::uint64_value)
+    {
+        unsigned long long value64 = 0;
+        (*this) >> value64;
+        value = static_cast<unsigned short>(value64);
+        return (*this);
+    }
+    pop_tag(serializationInternals::uint16_value);
+    if (varint_)
+    {
+        value = static_cast<unsigned short>(pop_varint());
+        return (*this);
+    }
+    internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned short));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
     return (*this);
 }
 
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator>>(char& value)
 {
-    assert(internals_->data_.front() == serializationInternals::char_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::char_value);
     internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(char));
     return (*this);
 }
@@ -611,8 +961,7 @@ multi_process_stream& multi_process_stream::operator>>(char& value)
 multi_process_stream& multi_process_stream::operator>>(bool& value)
 {
     char v;
-    assert(internals_->data_.front() == serializationInternals::char_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::char_value);
     internals_->Pop(reinterpret_cast<unsigned char*>(&v), sizeof(char));
     value = (v != 0);
     return (*this);
@@ -621,113 +970,239 @@ multi_process_stream& multi_process_stream::operator>>(bool& value)
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator>>(unsigned int& value)
 {
-    assert(internals_->data_.front() == serializationInternals::uint32_value);
-    internals_->data_.pop_front();
+    if (!schema_trusted_ && internals_->front() == serializationInternals::uint64_value)
+    {
+        unsigned long long value64 = 0;
+        (*this) >> value64;
+        value = static_cast<unsigned int>(value64);
+        return (*this);
+    }
+    pop_tag(serializationInternals::uint32_value);
+    if (varint_)
+    {
+        value = static_cast<unsigned int>(pop_varint());
+        return (*this);
+    }
     internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned int));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
     return (*this);
 }
 
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator>>(unsigned char& value)
 {
-    assert(internals_->data_.front() == serializationInternals::uchar_value);
-    internals_->data_.pop_front();
+    pop_tag(serializationInternals::uchar_value);
     internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned char));
     return (*this);
 }
 
 //----------------------------------------------------------------------------
-multi_process_stream& multi_process_stream::operator>>(int64_t& value)
+multi_process_stream& multi_process_stream::operator>>(long& value)
+{
+    pop_tag(serializationInternals::int64_value);
+    if (varint_)
+    {
+        value = static_cast<long>(zigzag_decode(pop_varint()));
+        return (*this);
+    }
+    long long wide = 0;
+    internals_->Pop(reinterpret_cast<unsigned char*>(&wide), sizeof(wide));
+    if (needs_byte_swap())
+    {
+        wide = byte_swap(wide);
+    }
+    value = static_cast<long>(wide);
+    return (*this);
+}
+
+//----------------------------------------------------------------------------
+multi_process_stream& multi_process_stream::operator>>(unsigned long& value)
 {
-    assert(internals_->data_.front() == serializationInternals::int64_value);
-    internals_->data_.pop_front();
-    internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(int64_t));
+    pop_tag(serializationInternals::uint64_value);
+    if (varint_)
+    {
+        value = static_cast<unsigned long>(pop_varint());
+        return (*this);
+    }
+    unsigned long long wide = 0;
+    internals_->Pop(reinterpret_cast<unsigned char*>(&wide), sizeof(wide));
+    if (needs_byte_swap())
+    {
+        wide = byte_swap(wide);
+    }
+    value = static_cast<unsigned long>(wide);
     return (*this);
 }
 
 //----------------------------------------------------------------------------
-//multi_process_stream& multi_process_stream::operator>>(uint64_t& value)
-//{
-//    assert(internals_->data_.front() == serializationInternals::uint64_value);
-//    internals_->data_.pop_front();
-//    internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(uint64_t));
-//    return (*this);
-//}
+multi_process_stream& multi_process_stream::operator>>(long long& value)
+{
+    pop_tag(serializationInternals::int64_value);
+    if (varint_)
+    {
+        value = static_cast<long long>(zigzag_decode(pop_varint()));
+        return (*this);
+    }
+    internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(long long));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
+    return (*this);
+}
 
 //----------------------------------------------------------------------------
-multi_process_stream& multi_process_stream::operator>>(size_t& value)
+multi_process_stream& multi_process_stream::operator>>(unsigned long long& value)
 {
-    assert(internals_->data_.front() == serializationInternals::size_value);
-    internals_->data_.pop_front();
-    internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(size_t));
+    pop_tag(serializationInternals::uint64_value);
+    if (varint_)
+    {
+        value = pop_varint();
+        return (*this);
+    }
+    internals_->Pop(reinterpret_cast<unsigned char*>(&value), sizeof(unsigned long long));
+    if (needs_byte_swap())
+    {
+        value = byte_swap(value);
+    }
     return (*this);
 }
 
 //----------------------------------------------------------------------------
 multi_process_stream& multi_process_stream::operator>>(std::string& value)
 {
-    value = "";
-    assert(internals_->data_.front() == serializationInternals::string_value);
-    internals_->data_.pop_front();
-    int stringSize;
-    internals_->Pop(reinterpret_cast<unsigned char*>(&stringSize), sizeof(int));
-    char c_value;
-    for (int idx = 0; idx < stringSize; idx++)
+    if (!schema_trusted_ &&
+        internals_->front() == serializationInternals::interned_string_value)
     {
-        internals_->Pop(reinterpret_cast<unsigned char*>(&c_value), sizeof(char));
-        value += c_value;
+        value = pop_interned_string();
+        return (*this);
     }
+    value = "";
+    pop_tag(serializationInternals::string_value);
+    const int stringSize = static_cast<int>(pop_size_field());
+    value.resize(static_cast<size_t>(stringSize));
+    internals_->Pop(
+        reinterpret_cast<unsigned char*>(value.data()), static_cast<size_t>(stringSize));
     return (*this);
 }
 
 //----------------------------------------------------------------------------
+// Zero-copy read: the view points directly at the string bytes inside the
+// stream's buffer instead of copying them out. With data borrowed through
+// SetRawData(pointer, size) the view stays valid as long as the caller's
+// buffer does; with owned data it is valid until the next push or Reset.
 multi_process_stream& multi_process_stream::operator>>(std::string_view& value)
 {
-    assert(internals_->data_.front() == serializationInternals::string_value);
-    internals_->data_.pop_front();
-    int stringSize;
-    internals_->Pop(reinterpret_cast<unsigned char*>(&stringSize), sizeof(int));
-    char        c_value;
-    std::string val = " ";
-    for (int idx = 0; idx < stringSize; idx++)
+    if (!schema_trusted_ &&
+        internals_->front() == serializationInternals::interned_string_value)
     {
-        internals_->Pop(reinterpret_cast<unsigned char*>(&c_value), sizeof(char));
-        val += c_value;
+        value = pop_interned_string();
+        return (*this);
     }
-
-    value = static_cast<std::string_view>(val);
-    value.remove_prefix(1);
+    pop_tag(serializationInternals::string_value);
+    const auto stringSize = static_cast<size_t>(pop_size_field());
+    value                 = std::string_view(
+        reinterpret_cast<const char*>(internals_->skip(stringSize)), stringSize);
     return (*this);
 }
 
 //----------------------------------------------------------------------------
 std::vector<unsigned char> multi_process_stream::GetRawData()
 {
-    const unsigned int         size = Size() + 1;
+    // A pending chunk list is folded first so the copy below is one
+    // contiguous memcpy.
+    if (!internals_->chunks_.empty())
+    {
+        internals_->coalesce_chunks();
+    }
+    const size_t               size = internals_->size();
     std::vector<unsigned char> ret(size + 1);
-    int                        idx = 0;
-    for (auto iter = internals_->data_.begin(); iter != internals_->data_.end(); ++iter, ++idx)
+    if (size > 0)
     {
-        ret[idx] = *iter;
+        std::memcpy(ret.data(), internals_->read_data() + internals_->read_pos_, size);
     }
-    ret[idx] = endianness_;
+    // The endianness byte is the last byte of the raw-data layout;
+    // SetRawData reads it from data.back().
+    ret[size] = endianness_;
 
     return ret;
 }
 
+//----------------------------------------------------------------------------
+std::vector<unsigned char> multi_process_stream::TakeRawData() &&
+{
+    std::vector<unsigned char> ret;
+    if (internals_->borrowed_ != nullptr)
+    {
+        // Borrowed data cannot be stolen; fall back to a copy.
+        ret.assign(
+            internals_->read_data() + internals_->read_pos_,
+            internals_->read_data() + internals_->read_size());
+    }
+    else
+    {
+        if (internals_->read_pos_ > 0)
+        {
+            internals_->data_.erase(
+                internals_->data_.begin(),
+                internals_->data_.begin() + static_cast<std::ptrdiff_t>(internals_->read_pos_));
+        }
+        ret = std::move(internals_->data_);
+    }
+    ret.push_back(endianness_);
+    internals_->clear();
+    return ret;
+}
+
+//----------------------------------------------------------------------------
+std::span<const unsigned char> multi_process_stream::GetRawDataView() const
+{
+    return {internals_->read_data() + internals_->read_pos_, internals_->size()};
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetRawData(const unsigned char* data, size_t size)
+{
+    internals_->clear();
+    internals_->intern_ids_.clear();
+    internals_->intern_names_.clear();
+    internals_->value_intern_counts_.clear();
+    internals_->value_intern_ids_.clear();
+    internals_->value_intern_names_.clear();
+    internals_->schemas_written_.clear();
+    internals_->schemas_read_.clear();
+    internals_->class_record_new_ = false;
+    if (data != nullptr && size > 0)
+    {
+        const auto endianness = data[size - 1];
+        internals_->borrowed_      = data;
+        internals_->borrowed_size_ = size - 1;
+        if (endianness_ != endianness)
+        {
+            endianness_ = endianness;
+        }
+    }
+}
+
 //----------------------------------------------------------------------------
 void multi_process_stream::SetRawData(const std::vector<unsigned char>& data)
 {
-    internals_->data_.clear();
+    internals_->clear();
+    internals_->intern_ids_.clear();
+    internals_->intern_names_.clear();
+    internals_->value_intern_counts_.clear();
+    internals_->value_intern_ids_.clear();
+    internals_->value_intern_names_.clear();
+    internals_->schemas_written_.clear();
+    internals_->schemas_read_.clear();
+    internals_->class_record_new_ = false;
     if (!data.empty())
     {
         const auto endianness = data.back();
-        internals_->data_.resize(data.size() - 1);
-        int cc = 0;
-        for (; cc < static_cast<int>(data.size() - 1); cc++)
-        {
-            internals_->data_[cc] = data[cc];
-        }
+        internals_->data_.assign(data.begin(), data.end() - 1);
         if (endianness_ != endianness)
         {
             endianness_ = endianness;
@@ -735,9 +1210,425 @@ void multi_process_stream::SetRawData(const std::vector<unsigned char>& data)
     }
 }
 
+//----------------------------------------------------------------------------
+std::vector<std::span<const unsigned char>> multi_process_stream::GetRawChunks() const
+{
+    std::vector<std::span<const unsigned char>> chunks;
+
+    // Unread remainder of the current buffer, then any adopted chunks
+    // still waiting behind it.
+    const std::span<const unsigned char> current{
+        internals_->read_data() + internals_->read_pos_,
+        internals_->read_size() - internals_->read_pos_};
+    if (!current.empty())
+    {
+        chunks.push_back(current);
+    }
+    for (size_t i = internals_->chunk_index_ + 1; i < internals_->chunks_.size(); ++i)
+    {
+        if (!internals_->chunks_[i].empty())
+        {
+            chunks.emplace_back(internals_->chunks_[i].data(), internals_->chunks_[i].size());
+        }
+    }
+
+    chunks.emplace_back(&endianness_, 1);
+    return chunks;
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetRawChunks(std::vector<std::vector<unsigned char>> chunks)
+{
+    internals_->clear();
+    internals_->intern_ids_.clear();
+    internals_->intern_names_.clear();
+    internals_->value_intern_counts_.clear();
+    internals_->value_intern_ids_.clear();
+    internals_->value_intern_names_.clear();
+    internals_->schemas_written_.clear();
+    internals_->schemas_read_.clear();
+    internals_->class_record_new_ = false;
+
+    while (!chunks.empty() && chunks.back().empty())
+    {
+        chunks.pop_back();
+    }
+    if (chunks.empty())
+    {
+        return;
+    }
+
+    // The concatenated layout matches SetRawData: the final byte is the
+    // endianness, everything before it is payload.
+    const auto endianness = chunks.back().back();
+    chunks.back().pop_back();
+    if (endianness_ != endianness)
+    {
+        endianness_ = endianness;
+    }
+    while (!chunks.empty() && chunks.back().empty())
+    {
+        chunks.pop_back();
+    }
+    if (!chunks.empty())
+    {
+        internals_->adopt_chunks(std::move(chunks));
+    }
+}
+
 //----------------------------------------------------------------------------
 unsigned char multi_process_stream::endianness() const
 {
     return endianness_;
 };
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetSchemaTrusted(bool enable)
+{
+    schema_trusted_ = enable;
+}
+
+//----------------------------------------------------------------------------
+bool multi_process_stream::SchemaTrusted() const
+{
+    return schema_trusted_;
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetVarintEncoding(bool enable)
+{
+    varint_ = enable;
+}
+
+//----------------------------------------------------------------------------
+bool multi_process_stream::VarintEncoding() const
+{
+    return varint_;
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetStringInterning(bool enable, unsigned int repeat_threshold)
+{
+    string_interning_        = enable;
+    string_intern_threshold_ = repeat_threshold;
+}
+
+//----------------------------------------------------------------------------
+bool multi_process_stream::StringInterning() const
+{
+    return string_interning_;
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::push_interned_string(std::string_view value)
+{
+    auto&       ids = internals_->value_intern_ids_;
+    std::string key(value);
+
+    const auto it = ids.find(key);
+    if (it != ids.end())
+    {
+        // Back-reference: a few bytes instead of the full payload.
+        push_tag(serializationInternals::interned_string_value);
+        push_size_field(it->second);
+        return;
+    }
+
+    const auto count = ++internals_->value_intern_counts_[key];
+    if (count <= string_intern_threshold_)
+    {
+        // Not repeated enough yet: ordinary string record.
+        push_tag(serializationInternals::string_value);
+        push_size_field(static_cast<unsigned int>(value.size()));
+        internals_->Push(reinterpret_cast<const unsigned char*>(value.data()), value.size());
+        return;
+    }
+
+    // Crossed the threshold: the defining record carries the id and the
+    // bytes once, every later occurrence is id-only.
+    const auto id = static_cast<unsigned int>(ids.size());
+    ids.emplace(std::move(key), id);
+    push_tag(serializationInternals::interned_string_value);
+    push_size_field(id);
+    push_size_field(static_cast<unsigned int>(value.size()));
+    internals_->Push(reinterpret_cast<const unsigned char*>(value.data()), value.size());
+}
+
+//----------------------------------------------------------------------------
+const std::string& multi_process_stream::pop_interned_string()
+{
+    pop_tag(serializationInternals::interned_string_value);
+    const auto id    = static_cast<size_t>(pop_size_field());
+    auto&      names = internals_->value_intern_names_;
+    if (id == names.size())
+    {
+        const auto  size = static_cast<size_t>(pop_size_field());
+        std::string name(size, '\0');
+        internals_->Pop(reinterpret_cast<unsigned char*>(name.data()), size);
+        names.push_back(std::move(name));
+    }
+    assert("pre: unknown interned string id" && id < names.size());
+    return names[id];
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetSink(
+    std::function<void(const unsigned char*, size_t)> sink, size_t chunk_size)
+{
+    internals_->sink_       = std::move(sink);
+    internals_->chunk_size_ = chunk_size;
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::Flush()
+{
+    internals_->flush();
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetSource(
+    std::function<bool(std::vector<unsigned char>&)> source, unsigned char archive_endianness)
+{
+    internals_->clear();
+    internals_->intern_ids_.clear();
+    internals_->intern_names_.clear();
+    internals_->value_intern_counts_.clear();
+    internals_->value_intern_ids_.clear();
+    internals_->value_intern_names_.clear();
+    internals_->schemas_written_.clear();
+    internals_->schemas_read_.clear();
+    internals_->class_record_new_ = false;
+    internals_->source_           = std::move(source);
+    if (endianness_ != archive_endianness)
+    {
+        endianness_ = archive_endianness;
+    }
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::PushClassName(const std::string& name)
+{
+    // While recording a field index every member slice must stay
+    // self-contained, so interned back-references are not used.
+    const auto it = field_index_enabled_ ? internals_->intern_ids_.end()
+                                         : internals_->intern_ids_.find(name);
+    if (it != internals_->intern_ids_.end())
+    {
+        internals_->class_record_new_ = false;
+        operator<<(it->second);
+        return;
+    }
+    internals_->class_record_new_ = true;
+
+    const auto id = field_index_enabled_
+                        ? static_cast<unsigned int>(intern_name_count_++)
+                        : static_cast<unsigned int>(internals_->intern_ids_.size());
+    if (!field_index_enabled_)
+    {
+        internals_->intern_ids_.emplace(name, id);
+    }
+    operator<<(id);
+    operator<<(name);
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::SetFieldIndexEnabled(bool enable)
+{
+    field_index_enabled_ = enable;
+}
+
+//----------------------------------------------------------------------------
+bool multi_process_stream::FieldIndexEnabled() const
+{
+    return field_index_enabled_;
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::PushFieldScope(std::string_view name)
+{
+    if (!field_index_enabled_)
+    {
+        return;
+    }
+    auto& path = internals_->field_path_;
+    if (path.empty())
+    {
+        path.emplace_back(name);
+    }
+    else
+    {
+        path.push_back(path.back() + "." + std::string(name));
+    }
+    internals_->field_starts_.push_back(internals_->data_.size());
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::PopFieldScope()
+{
+    if (!field_index_enabled_)
+    {
+        return;
+    }
+    const size_t start = internals_->field_starts_.back();
+    internals_->field_entries_.push_back(
+        {internals_->field_path_.back(), start, internals_->data_.size() - start});
+    internals_->field_path_.pop_back();
+    internals_->field_starts_.pop_back();
+}
+
+//----------------------------------------------------------------------------
+const std::vector<field_index_entry>& multi_process_stream::FieldIndex() const
+{
+    return internals_->field_entries_;
+}
+
+//----------------------------------------------------------------------------
+const std::string& multi_process_stream::PopClassName()
+{
+    unsigned int id = 0;
+    operator>>(id);
+    internals_->class_record_new_ = (id == internals_->intern_names_.size());
+    if (id == internals_->intern_names_.size())
+    {
+        std::string name;
+        operator>>(name);
+        internals_->intern_names_.push_back(std::move(name));
+    }
+    assert("pre: unknown interned class-name id" && id < internals_->intern_names_.size());
+    return internals_->intern_names_[id];
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::PushSchema(const std::string& name, uint64_t fingerprint)
+{
+    auto& schemas = internals_->schemas_written_;
+    if (!internals_->class_record_new_ && schemas.count(name) != 0)
+    {
+        return;
+    }
+    schemas.emplace(name, fingerprint);
+    operator<<(static_cast<int64_t>(fingerprint));
+}
+
+//----------------------------------------------------------------------------
+bool multi_process_stream::PopSchema(const std::string& name, uint64_t expected)
+{
+    auto&      schemas = internals_->schemas_read_;
+    const auto it      = schemas.find(name);
+    if (internals_->class_record_new_ || it == schemas.end())
+    {
+        int64_t stored = 0;
+        operator>>(stored);
+        const auto fingerprint = static_cast<uint64_t>(stored);
+        if (it == schemas.end())
+        {
+            schemas.emplace(name, fingerprint);
+        }
+        return fingerprint == expected;
+    }
+    return it->second == expected;
+}
+
+//----------------------------------------------------------------------------
+multi_process_stream multi_process_stream::ForkWriteState() const
+{
+    multi_process_stream fork;
+    fork.endianness_                  = endianness_;
+    fork.schema_trusted_              = schema_trusted_;
+    fork.varint_                      = varint_;
+    fork.internals_->intern_ids_      = internals_->intern_ids_;
+    fork.internals_->schemas_written_ = internals_->schemas_written_;
+    // Workers write strings in full: ids handed out concurrently would
+    // not splice into one coherent dictionary.
+    fork.string_interning_ = false;
+    return fork;
+}
+
+//----------------------------------------------------------------------------
+size_t multi_process_stream::InternedNameCount() const
+{
+    return internals_->intern_ids_.size();
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::AppendSegment(const multi_process_stream& segment)
+{
+    const auto view = segment.GetRawDataView();
+    internals_->Push(view.data(), view.size());
+}
+
+//----------------------------------------------------------------------------
+void multi_process_stream::push_size_field(unsigned int size)
+{
+    if (varint_)
+    {
+        push_varint(size);
+        return;
+    }
+    internals_->Push(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+}
+
+//----------------------------------------------------------------------------
+unsigned int multi_process_stream::pop_size_field()
+{
+    if (varint_)
+    {
+        return static_cast<unsigned int>(pop_varint());
+    }
+    unsigned int size;
+    internals_->Pop(reinterpret_cast<unsigned char*>(&size), sizeof(unsigned int));
+    if (needs_byte_swap())
+    {
+        size = byte_swap(size);
+    }
+    return size;
+}
+
+//----------------------------------------------------------------------------
+namespace
+{
+// Per-thread free list of recycled streams. Bounded so a burst of nested
+// checkouts cannot pin an unbounded amount of arena capacity per thread.
+constexpr size_t POOLED_STREAM_LIMIT = 4;
+
+std::vector<std::unique_ptr<multi_process_stream>>& pooled_free_list()
+{
+    static thread_local std::vector<std::unique_ptr<multi_process_stream>> free_list;
+    return free_list;
+}
+}  // namespace
+
+//----------------------------------------------------------------------------
+pooled_stream::pooled_stream()
+{
+    auto& free_list = pooled_free_list();
+    if (free_list.empty())
+    {
+        stream_ = new multi_process_stream();
+        return;
+    }
+    stream_ = free_list.back().release();
+    free_list.pop_back();
+}
+
+//----------------------------------------------------------------------------
+pooled_stream::~pooled_stream()
+{
+    auto& free_list = pooled_free_list();
+    if (free_list.size() >= POOLED_STREAM_LIMIT)
+    {
+        delete stream_;
+        return;
+    }
+    // Scrub everything a previous user could have configured: Reset()
+    // clears the data and tables, the setters restore the default modes,
+    // and an empty sink detaches streaming.
+    stream_->Reset();
+    stream_->SetSchemaTrusted(false);
+    stream_->SetVarintEncoding(false);
+    stream_->SetStringInterning(false);
+    stream_->SetFieldIndexEnabled(false);
+    stream_->SetSink({});
+    free_list.emplace_back(stream_);
+}
 }  // namespace serialization
@@ -15,40 +15,68 @@
 
 #pragma once
 
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <deque>
+#include <functional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "util/export.h"
+#include "util/flat_hash.h"
 
 namespace serialization
 {
+/**
+ * One entry of the optional field index recorded while serializing:
+ * dotted reflection path of a member and the byte range its encoding
+ * occupies in the archive payload.
+ */
+struct field_index_entry
+{
+    std::string path;
+    size_t      offset{0};
+    size_t      length{0};
+};
+
 class SERIALIZATION_API multi_process_stream
 {
 public:
     multi_process_stream();
     multi_process_stream(const multi_process_stream& other);
+    multi_process_stream(multi_process_stream&& other) noexcept;
     ~multi_process_stream();
     multi_process_stream& operator=(const multi_process_stream& other);
+    multi_process_stream& operator=(multi_process_stream&& other) noexcept;
 
     //@{
     /**
      * Add-to-stream operators. Adds to the end of the stream.
+     * Integral overloads are spelled in terms of the fundamental types so
+     * the fixed-width aliases (int16_t .. uint64_t) resolve on every
+     * platform without colliding. long and long long (signed and
+     * unsigned) always occupy 8 bytes on the wire, and the 32-bit
+     * extraction operators narrow a 64-bit record on the fly, so archives
+     * exchanged between 32- and 64-bit builds load without a conversion
+     * shim.
      */
     multi_process_stream& operator<<(double value);
     multi_process_stream& operator<<(float value);
     multi_process_stream& operator<<(int value);
     multi_process_stream& operator<<(short value);
+    multi_process_stream& operator<<(unsigned short value);
     multi_process_stream& operator<<(char value);
     multi_process_stream& operator<<(bool value);
     multi_process_stream& operator<<(unsigned int value);
     multi_process_stream& operator<<(unsigned char value);
-    multi_process_stream& operator<<(int64_t value);
-    //multi_process_stream& operator<<(uint64_t value);
-    multi_process_stream& operator<<(size_t value);
+    multi_process_stream& operator<<(long value);
+    multi_process_stream& operator<<(unsigned long value);
+    multi_process_stream& operator<<(long long value);
+    multi_process_stream& operator<<(unsigned long long value);
     multi_process_stream& operator<<(const std::string& value);
     multi_process_stream& operator<<(const std::string_view& value);
     multi_process_stream& operator<<(const char* value);
@@ -62,13 +90,15 @@ public:
     multi_process_stream& operator>>(float& value);
     multi_process_stream& operator>>(int& value);
     multi_process_stream& operator>>(short& value);
+    multi_process_stream& operator>>(unsigned short& value);
     multi_process_stream& operator>>(char& value);
     multi_process_stream& operator>>(bool& value);
     multi_process_stream& operator>>(unsigned int& value);
     multi_process_stream& operator>>(unsigned char& value);
-    multi_process_stream& operator>>(int64_t& value);
-    //multi_process_stream& operator>>(uint64_t& value);
-    multi_process_stream& operator>>(size_t& value);
+    multi_process_stream& operator>>(long& value);
+    multi_process_stream& operator>>(unsigned long& value);
+    multi_process_stream& operator>>(long long& value);
+    multi_process_stream& operator>>(unsigned long long& value);
     multi_process_stream& operator>>(std::string& value);
     multi_process_stream& operator>>(std::string_view& value);
     //@}
@@ -80,12 +110,15 @@ public:
     void Push(const double* array, unsigned int size);
     void Push(const float* array, unsigned int size);
     void Push(const int* array, unsigned int size);
+    void Push(const short* array, unsigned int size);
+    void Push(const unsigned short* array, unsigned int size);
     void Push(const char* array, unsigned int size);
     void Push(const unsigned int* array, unsigned int size);
     void Push(const unsigned char* array, unsigned int size);
-    void Push(const int64_t* array, unsigned int size);
-    //void Push(const uint64_t* array, unsigned int size);
-    void Push(const size_t* array, unsigned int size);
+    void Push(const long* array, unsigned int size);
+    void Push(const unsigned long* array, unsigned int size);
+    void Push(const long long* array, unsigned int size);
+    void Push(const unsigned long long* array, unsigned int size);
     //@}
 
     //@{
@@ -99,14 +132,24 @@ public:
     void Pop(double*& array, unsigned int& size);
     void Pop(float*& array, unsigned int& size);
     void Pop(int*& array, unsigned int& size);
+    void Pop(short*& array, unsigned int& size);
+    void Pop(unsigned short*& array, unsigned int& size);
     void Pop(char*& array, unsigned int& size);
     void Pop(unsigned int*& array, unsigned int& size);
     void Pop(unsigned char*& array, unsigned int& size);
-    void Pop(int64_t*& array, unsigned int& size);
-    //void Pop(uint64_t*& array, unsigned int& size);
-    void Pop(size_t*& array, unsigned int& size);
+    void Pop(long*& array, unsigned int& size);
+    void Pop(unsigned long*& array, unsigned int& size);
+    void Pop(long long*& array, unsigned int& size);
+    void Pop(unsigned long long*& array, unsigned int& size);
     //@}
 
+    /**
+     * Pre-allocates the internal arena to hold at least @a bytes of data,
+     * so a serialization pass of known (or estimated) size grows the
+     * buffer once instead of reallocating as it goes.
+     */
+    void Reserve(size_t bytes);
+
     /**
      * Clears everything in the stream.
      */
@@ -131,20 +174,368 @@ public:
     //@{
     /**
      * Serialization methods used to save/restore the stream to/from raw data.
-     * Note: The 1st byte of the raw data buffer consists of the endian type.
+     * Note: The last byte of the raw data buffer consists of the endian type.
      */
     std::vector<unsigned char> GetRawData();
     void                       SetRawData(const std::vector<unsigned char>& data);
     //@}
 
+    //@{
+    /**
+     * Zero-copy counterparts of GetRawData/SetRawData.
+     * TakeRawData steals the internal buffer (the stream is empty
+     * afterwards); the raw data layout matches SetRawData, i.e. the last
+     * byte is the endian type. GetRawDataView returns a view of the unread
+     * payload without the endian byte and without copying. The pointer
+     * overload of SetRawData borrows the caller's buffer: the stream reads
+     * directly from it and the caller must keep it alive until the stream
+     * is done. Pushing into a borrowing stream copies the unread remainder
+     * into the owned arena first, ending the borrow.
+     */
+    std::vector<unsigned char>     TakeRawData() &&;
+    std::span<const unsigned char> GetRawDataView() const;
+    void                           SetRawData(const unsigned char* data, size_t size);
+    //@}
+
+    //@{
+    /**
+     * Scatter-gather counterparts of GetRawData/SetRawData. GetRawChunks
+     * returns the archive as a list of iovec-compatible spans — the unread
+     * payload followed by a one-byte span holding the endianness — so
+     * network code can writev straight out of the stream's buffers instead
+     * of coalescing into a vector first. The spans stay valid until the
+     * next push or Reset. SetRawChunks adopts received buffers as-is:
+     * reads walk the chunk list in place, and the unread remainder is
+     * copied into the owned arena only if a value straddles a chunk
+     * boundary. The concatenated chunks must form one SetRawData-
+     * compatible buffer, i.e. the very last byte is the endianness.
+     */
+    std::vector<std::span<const unsigned char>> GetRawChunks() const;
+    void SetRawChunks(std::vector<std::vector<unsigned char>> chunks);
+    //@}
+
     unsigned char endianness() const;
 
+    //@{
+    /**
+     * Schema-trusted (untagged) mode. When enabled, values are written
+     * without the one-byte type tag that normally precedes every scalar,
+     * array and string, shrinking tag-dominated archives and removing the
+     * per-value tag branch on read. The reader must pop exactly the type
+     * sequence that was pushed (which the reflection machinery guarantees),
+     * and the mode must be selected identically on both sides before any
+     * data is pushed or popped; it is not recorded in the raw data.
+     */
+    void SetSchemaTrusted(bool enable);
+    bool SchemaTrusted() const;
+    //@}
+
+    //@{
+    /**
+     * Varint (LEB128) integer mode. When enabled, integral scalars and the
+     * size prefixes of arrays and strings are encoded as LEB128 varints,
+     * signed values zig-zag encoded, instead of fixed-width words. Small
+     * values — the common case for container sizes and indices — take one
+     * byte instead of four or eight, and varints are endianness-neutral.
+     * Floating-point and character payloads stay fixed-width. Like
+     * schema-trusted mode, the same setting must be selected on both sides
+     * before any data is pushed or popped; it is not recorded in the raw
+     * data.
+     */
+    void SetVarintEncoding(bool enable);
+    bool VarintEncoding() const;
+    //@}
+
+    //@{
+    /**
+     * Value-string dictionary mode. When enabled, a string that has been
+     * written more than @a repeat_threshold times is interned: the first
+     * interned record carries the id and the full bytes, every later
+     * occurrence is an id-only back-reference. Repeated payload strings —
+     * currency codes, calendar names, counterparty ids — then cost a few
+     * bytes per occurrence instead of their full length, and the reader
+     * parses each distinct value once into a dictionary it assigns from
+     * (string_view extraction aliases the dictionary entry without
+     * copying). The record layout is self-describing, so the reader needs
+     * no matching mode. Requires type tags (ignored in schema-trusted
+     * mode) and is bypassed while a field index is recorded so member
+     * slices stay self-contained.
+     */
+    void SetStringInterning(bool enable, unsigned int repeat_threshold = 1);
+    bool StringInterning() const;
+    //@}
+
+    //@{
+    /**
+     * Streaming sink. When a sink is attached the stream becomes
+     * write-only: whenever the internal arena reaches @a chunk_size bytes
+     * it is handed to the sink and recycled, so transient memory stays
+     * bounded by the chunk size no matter how large the archive grows.
+     * Flush hands over whatever is left in the arena. The sink receives
+     * the archive payload only; a writer producing SetRawData-compatible
+     * raw data must append the endianness byte itself after the final
+     * Flush. Popping from a sink-backed stream is not supported.
+     */
+    void SetSink(std::function<void(const unsigned char*, size_t)> sink, size_t chunk_size = 65536);
+    void Flush();
+    //@}
+
+    /**
+     * Streaming source, the read-side counterpart of SetSink. Whenever a
+     * pop needs bytes beyond what has arrived, @a source is called to
+     * fill the next chunk; it blocks until one is available and returns
+     * false (or an empty chunk) at end of stream, after which reads see
+     * the stream as exhausted. Chunks are consumed through the same
+     * in-place chunk walk as SetRawChunks — a value straddling a chunk
+     * boundary folds the unread remainder into the owned arena, anything
+     * else is read without copying. The source delivers the archive
+     * payload only; the trailing endianness byte of the raw-data layout
+     * is passed as @a archive_endianness, so decoding can begin before
+     * the tail of the archive has been read. Consumed chunks are
+     * recycled as new ones arrive, so zero-copy string_view extraction
+     * must be copied before the read position leaves the chunk it
+     * aliases.
+     */
+    void SetSource(
+        std::function<bool(std::vector<unsigned char>&)> source,
+        unsigned char                                    archive_endianness);
+
+    //@{
+    /**
+     * Interned class-name records. The first occurrence of a name writes
+     * a fresh id followed by the string; every later occurrence writes the
+     * id alone, so archives holding containers of polymorphic objects do
+     * not repeat the same demangled name per element. Ids are assigned in
+     * first-use order on both sides, making the records self-describing.
+     * The reader resolves ids against its table and returns a reference
+     * into it, avoiding a string allocation per object.
+     */
+    void               PushClassName(const std::string& name);
+    const std::string& PopClassName();
+    //@}
+
+    //@{
+    /**
+     * Schema fingerprint records. Each reflectable type's compile-time
+     * layout fingerprint travels with its class name: PushSchema writes
+     * the eight-byte value when the preceding class-name record carried
+     * the name string, or when the name has not carried a fingerprint in
+     * this archive yet; later occurrences cost nothing. PopSchema mirrors
+     * the rule, records the archive's fingerprint per name, and returns
+     * whether it equals @a expected, so writer/reader layout drift is
+     * caught at the first object of a type instead of corrupting data
+     * silently.
+     */
+    void PushSchema(const std::string& name, uint64_t fingerprint);
+    bool PopSchema(const std::string& name, uint64_t expected);
+    //@}
+
+    //@{
+    /**
+     * Field-index recording for partial/lazy deserialization. When
+     * enabled, the reflection walk brackets every member with
+     * PushFieldScope/PopFieldScope and the stream records one
+     * field_index_entry per member with its byte range in the payload, so
+     * a footer can be appended and individual fields decoded later
+     * without touching the rest of the archive. Class-name interning is
+     * bypassed while recording so every member slice stays
+     * self-contained. Not compatible with a streaming sink.
+     */
+    void SetFieldIndexEnabled(bool enable);
+    bool FieldIndexEnabled() const;
+    void PushFieldScope(std::string_view name);
+    void PopFieldScope();
+
+    const std::vector<field_index_entry>& FieldIndex() const;
+    //@}
+
+    //@{
+    /**
+     * Parallel-save worker support. ForkWriteState returns an empty
+     * stream configured like this one (endianness, schema-trusted and
+     * varint modes) and seeded with the write-side intern and schema
+     * tables, so bytes it produces splice verbatim after this stream's
+     * as long as the worker interns no new class name.
+     * InternedNameCount exposes the write-side table size for that
+     * check, and AppendSegment splices a worker stream's payload onto
+     * this stream.
+     */
+    [[nodiscard]] multi_process_stream ForkWriteState() const;
+    [[nodiscard]] size_t               InternedNameCount() const;
+    void                               AppendSegment(const multi_process_stream& segment);
+    //@}
+
+    /**
+     * True when the endianness recorded in the stream (updated by
+     * SetRawData) differs from the host byte order, in which case typed
+     * reads must byte-swap the popped values. The memcpy fast paths of
+     * the binary loader consult this to swap members after a block copy.
+     */
+    bool needs_byte_swap() const
+    {
+#ifdef SERIALIZATION_WORDS_BIGENDIAN
+        return endianness_ != BigEndian;
+#else
+        return endianness_ != LittleEndian;
+#endif
+    }
+
 private:
+    /**
+     * Write/consume the one-byte type tag unless the stream runs in
+     * schema-trusted mode.
+     */
+    /**
+     * Value-string dictionary records (see SetStringInterning): the push
+     * helper decides between a plain record, a defining record (id plus
+     * bytes) and an id-only back-reference; the pop helper resolves a
+     * record into the read-side dictionary and returns the entry.
+     */
+    void               push_interned_string(std::string_view value);
+    const std::string& pop_interned_string();
+
+    void push_tag(unsigned char tag)
+    {
+        if (!schema_trusted_)
+        {
+            internals_->push_back(tag);
+        }
+    }
+
+    void pop_tag([[maybe_unused]] unsigned char tag)
+    {
+        if (!schema_trusted_)
+        {
+            assert("pre: unexpected type tag in stream" && internals_->front() == tag);
+            internals_->pop_front();
+        }
+    }
+
+    //@{
+    /**
+     * LEB128 varint primitives: 7 payload bits per byte, high bit set on
+     * every byte but the last. Signed values go through the zig-zag map so
+     * small negative numbers stay short.
+     */
+    void push_varint(uint64_t value)
+    {
+        while (value >= 0x80U)
+        {
+            internals_->push_back(static_cast<unsigned char>(value) | 0x80U);
+            value >>= 7U;
+        }
+        internals_->push_back(static_cast<unsigned char>(value));
+    }
+
+    uint64_t pop_varint()
+    {
+        uint64_t value = 0;
+        unsigned shift = 0;
+        unsigned char byte;
+        do
+        {
+            byte = internals_->front();
+            internals_->pop_front();
+            value |= static_cast<uint64_t>(byte & 0x7FU) << shift;
+            shift += 7U;
+        } while ((byte & 0x80U) != 0U && shift < 64U);
+        if (internals_->empty())
+        {
+            internals_->clear();
+        }
+        return value;
+    }
+
+    static uint64_t zigzag_encode(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1U) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    static int64_t zigzag_decode(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1U) ^ -static_cast<int64_t>(value & 1U);
+    }
+    //@}
+
+    //@{
+    /**
+     * Size prefix of arrays and strings: fixed 4-byte word, or a varint
+     * when varint mode is enabled.
+     */
+    void         push_size_field(unsigned int size);
+    unsigned int pop_size_field();
+    //@}
+
     class serializationInternals
     {
     public:
-        using DataType = std::deque<unsigned char>;
+        /**
+         * Contiguous arena holding the archive bytes. The buffer only grows
+         * (geometrically, via std::vector) while writing; reads advance a
+         * cursor instead of erasing from the front, so both directions are
+         * bulk memcpy operations.
+         */
+        using DataType = std::vector<unsigned char>;
         DataType data_;
+        size_t   read_pos_{0};
+
+        // Borrowed-buffer mode: when borrowed_ is set, reads come straight
+        // out of the caller's memory instead of the owned arena.
+        const unsigned char* borrowed_{nullptr};
+        size_t               borrowed_size_{0};
+
+        // Chunk-list mode (see SetRawChunks): the adopted buffers, the one
+        // currently exposed through borrowed_, and the bytes still waiting
+        // in the chunks after it.
+        std::vector<std::vector<unsigned char>> chunks_;
+        size_t                                  chunk_index_{0};
+        size_t                                  chunks_remaining_{0};
+
+        // Streaming sink: when set, writes are handed over chunk-wise and
+        // the arena is recycled instead of growing with the archive.
+        std::function<void(const unsigned char*, size_t)> sink_;
+        size_t                                            chunk_size_{0};
+
+        // Streaming source (see SetSource): pulled for the next chunk when
+        // a read outruns what has arrived; dropped once it reports end of
+        // stream.
+        std::function<bool(std::vector<unsigned char>&)> source_;
+
+        // Bytes pushed while a source is active (the shared_ptr loader
+        // re-inserts a class name during load). In buffered modes such
+        // bytes land behind the unread remainder of the whole archive;
+        // with a source the remainder has not arrived yet, so they are
+        // parked here and spliced in as the final chunk once the source
+        // is exhausted, keeping the byte order identical.
+        DataType deferred_;
+
+        // Class-name interning tables: ids are handed out in first-use
+        // order while writing and resolved positionally while reading.
+        quarisma::quarisma_map<std::string, unsigned int> intern_ids_;
+        std::vector<std::string>                          intern_names_;
+
+        // Value-string dictionary (see SetStringInterning): write-side
+        // occurrence counts and assigned ids, read-side distinct values.
+        // A deque keeps extracted string_views stable across growth.
+        quarisma::quarisma_map<std::string, unsigned int> value_intern_counts_;
+        quarisma::quarisma_map<std::string, unsigned int> value_intern_ids_;
+        std::deque<std::string>                           value_intern_names_;
+
+        // Schema fingerprints (see PushSchema): the fingerprints written
+        // and read per class name, plus whether the most recent
+        // class-name record carried the name string. Separate write/read
+        // maps keep a stream that is saved into and then loaded from in
+        // step.
+        quarisma::quarisma_map<std::string, uint64_t> schemas_written_;
+        quarisma::quarisma_map<std::string, uint64_t> schemas_read_;
+        bool                                          class_record_new_{false};
+
+        // Field-index recording (see SetFieldIndexEnabled): a stack of
+        // cumulative dotted paths with their start offsets, and the
+        // finished entries.
+        std::vector<std::string>       field_path_;
+        std::vector<size_t>            field_starts_;
+        std::vector<field_index_entry> field_entries_;
 
         enum Types
         {
@@ -157,38 +548,335 @@ private:
             string_value,
             int64_value,
             uint64_value,
-            size_value
+            // Legacy platform-width size_t tag; retained so the numeric
+            // values of the tags that follow stay stable. 64-bit values
+            // now travel as (u)int64_value regardless of platform.
+            size_value,
+            int16_value,
+            uint16_value,
+            interned_string_value
         };
 
+        const unsigned char* read_data() const
+        {
+            return (borrowed_ != nullptr) ? borrowed_ : data_.data();
+        }
+
+        size_t read_size() const { return (borrowed_ != nullptr) ? borrowed_size_ : data_.size(); }
+
+        // A push into a stream that borrows external data first copies the
+        // unread remainder into the owned arena, so mixed read/write usage
+        // (e.g. the shared_ptr loader re-inserting a class name) stays
+        // correct and only pays for the copy when it actually happens.
+        // Takes ownership of received buffers without coalescing them: the
+        // first chunk is exposed through the borrowed-buffer pointers and
+        // reads advance through the list chunk by chunk.
+        void adopt_chunks(std::vector<std::vector<unsigned char>>&& chunks)
+        {
+            chunks_           = std::move(chunks);
+            chunk_index_      = 0;
+            chunks_remaining_ = 0;
+            for (size_t i = 1; i < chunks_.size(); ++i)
+            {
+                chunks_remaining_ += chunks_[i].size();
+            }
+            borrowed_      = chunks_.front().data();
+            borrowed_size_ = chunks_.front().size();
+            read_pos_      = 0;
+        }
+
+        // Advances past exhausted chunks so the scalar read primitives
+        // always find the next unread byte at read_pos_ of the current one.
+        void ensure_readable()
+        {
+            while (chunk_index_ + 1 < chunks_.size() && read_pos_ == borrowed_size_)
+            {
+                ++chunk_index_;
+                borrowed_      = chunks_[chunk_index_].data();
+                borrowed_size_ = chunks_[chunk_index_].size();
+                chunks_remaining_ -= borrowed_size_;
+                read_pos_ = 0;
+            }
+        }
+
+        // A read straddles the current chunk boundary: fold the unread
+        // remainder of the whole list into the owned arena and release it.
+        // Like materialize(), this invalidates earlier zero-copy views.
+        void coalesce_chunks()
+        {
+            DataType merged;
+            merged.reserve(size());
+            merged.insert(merged.end(), borrowed_ + read_pos_, borrowed_ + borrowed_size_);
+            for (size_t i = chunk_index_ + 1; i < chunks_.size(); ++i)
+            {
+                merged.insert(merged.end(), chunks_[i].begin(), chunks_[i].end());
+            }
+            chunks_.clear();
+            chunk_index_      = 0;
+            chunks_remaining_ = 0;
+            data_             = std::move(merged);
+            borrowed_         = nullptr;
+            borrowed_size_    = 0;
+            read_pos_         = 0;
+        }
+
+        void materialize()
+        {
+            if (!chunks_.empty())
+            {
+                coalesce_chunks();
+                return;
+            }
+            if (borrowed_ != nullptr)
+            {
+                data_.assign(borrowed_ + read_pos_, borrowed_ + borrowed_size_);
+                borrowed_      = nullptr;
+                borrowed_size_ = 0;
+                read_pos_      = 0;
+            }
+        }
+
+        // Pulls one chunk from the streaming source and splices it behind
+        // the unread bytes. A fresh chunk normally enters the chunk walk
+        // untouched; only when a straddling read has already folded the
+        // remainder into the owned arena does it get appended there.
+        bool refill()
+        {
+            if (!source_)
+            {
+                return false;
+            }
+            std::vector<unsigned char> chunk;
+            if (!source_(chunk) || chunk.empty())
+            {
+                source_ = nullptr;
+                if (deferred_.empty())
+                {
+                    return false;
+                }
+                chunk = std::move(deferred_);
+                deferred_.clear();
+            }
+            if (!chunks_.empty())
+            {
+                // Consumed chunks are dropped as new ones arrive, so a
+                // streamed load holds a ring's worth of buffers rather
+                // than the whole archive. (The inner buffers do not move,
+                // so borrowed_ stays valid across the erase.)
+                if (chunk_index_ > 0)
+                {
+                    chunks_.erase(
+                        chunks_.begin(),
+                        chunks_.begin() + static_cast<std::ptrdiff_t>(chunk_index_));
+                    chunk_index_ = 0;
+                }
+                chunks_remaining_ += chunk.size();
+                chunks_.push_back(std::move(chunk));
+            }
+            else if (borrowed_ == nullptr && read_pos_ >= data_.size())
+            {
+                data_.clear();
+                read_pos_ = 0;
+                std::vector<std::vector<unsigned char>> list;
+                list.push_back(std::move(chunk));
+                adopt_chunks(std::move(list));
+            }
+            else
+            {
+                materialize();
+                data_.insert(data_.end(), chunk.begin(), chunk.end());
+            }
+            return true;
+        }
+
         void Push(const unsigned char* data, size_t length)
         {
-            for (size_t cc = 0; cc < length; cc++)
+            if (source_)
             {
-                data_.push_back(data[cc]);
+                deferred_.insert(deferred_.end(), data, data + length);
+                return;
             }
+            materialize();
+            if (length == 0)
+            {
+                return;
+            }
+            data_.insert(data_.end(), data, data + length);
+            maybe_flush();
         }
 
         void Pop(unsigned char* data, size_t length)
         {
-            if (!data_.empty())
+            assert("pre: cannot pop from a stream with an attached sink" && !sink_);
+            while (source_ && size() < length && refill())
             {
-                for (size_t cc = 0; cc < length; cc++)
+            }
+            ensure_readable();
+            size_t available = read_size() - read_pos_;
+            if (length > available && chunks_remaining_ > 0)
+            {
+                coalesce_chunks();
+                available = read_size() - read_pos_;
+            }
+            if (length > available)
+            {
+                length = available;
+            }
+            if (length > 0)
+            {
+                std::memcpy(data, read_data() + read_pos_, length);
+                read_pos_ += length;
+            }
+            // Everything consumed: recycle the arena (or release the
+            // borrow) so the next write starts at offset zero again.
+            if (read_pos_ == read_size())
+            {
+                if (chunks_remaining_ > 0)
+                {
+                    ensure_readable();
+                }
+                else if (!source_)
                 {
-                    data[cc] = data_.front();
-                    data_.pop_front();
+                    clear();
                 }
             }
         }
+
+        // Advances past length bytes without copying them out, leaving the
+        // skipped range addressable for zero-copy views. Unlike Pop this
+        // never recycles the arena on full consumption: a view handed out
+        // for the final bytes must stay valid after the skip.
+        const unsigned char* skip(size_t length)
+        {
+            assert("pre: cannot skip in a stream with an attached sink" && !sink_);
+            while (source_ && size() < length && refill())
+            {
+            }
+            ensure_readable();
+            size_t available = read_size() - read_pos_;
+            if (length > available && chunks_remaining_ > 0)
+            {
+                coalesce_chunks();
+                available = read_size() - read_pos_;
+            }
+            if (length > available)
+            {
+                length = available;
+            }
+            const unsigned char* result = read_data() + read_pos_;
+            read_pos_ += length;
+            return result;
+        }
+
+        void push_back(unsigned char byte)
+        {
+            if (source_)
+            {
+                deferred_.push_back(byte);
+                return;
+            }
+            materialize();
+            data_.push_back(byte);
+            maybe_flush();
+        }
+
+        unsigned char front()
+        {
+            while (source_ && empty() && refill())
+            {
+            }
+            ensure_readable();
+            return read_data()[read_pos_];
+        }
+
+        void pop_front()
+        {
+            while (source_ && empty() && refill())
+            {
+            }
+            ensure_readable();
+            ++read_pos_;
+        }
+
+        size_t size() const { return read_size() - read_pos_ + chunks_remaining_; }
+
+        bool empty() const { return size() == 0; }
+
+        void maybe_flush()
+        {
+            if (sink_ && data_.size() >= chunk_size_)
+            {
+                flush();
+            }
+        }
+
+        void flush()
+        {
+            if (sink_ && !data_.empty())
+            {
+                sink_(data_.data() + read_pos_, data_.size() - read_pos_);
+                data_.clear();
+                read_pos_ = 0;
+            }
+        }
+
+        void clear()
+        {
+            data_.clear();
+            borrowed_      = nullptr;
+            borrowed_size_ = 0;
+            read_pos_      = 0;
+            chunks_.clear();
+            chunk_index_      = 0;
+            chunks_remaining_ = 0;
+            source_           = nullptr;
+            deferred_.clear();
+        }
     };
 
     serializationInternals* internals_;
     unsigned char           endianness_;
+    bool                    schema_trusted_{false};
+    bool                    varint_{false};
+    bool                    string_interning_{false};
+    unsigned int            string_intern_threshold_{1};
+    bool                    field_index_enabled_{false};
+    size_t                  intern_name_count_{0};
     enum
     {
         BigEndian,
         LittleEndian
     };
 };
+
+/**
+ * @class   pooled_stream
+ * @brief   RAII checkout of a thread-local reusable multi_process_stream.
+ *
+ * Constructing a stream heap-allocates its internals; a hot path that
+ * serializes many small objects pays that cost on every call. pooled_stream
+ * checks a stream out of a small per-thread free list instead, and its
+ * destructor resets the stream (clearing data, interning tables, schema
+ * fingerprints, sink and mode flags) and returns it for the next checkout,
+ * so the internals allocation and the table capacity are recycled. The pool
+ * is bounded; checkouts beyond the bound fall back to a fresh stream that
+ * is simply destroyed on return.
+ */
+class SERIALIZATION_API pooled_stream
+{
+public:
+    pooled_stream();
+    ~pooled_stream();
+
+    pooled_stream(const pooled_stream&)            = delete;
+    pooled_stream& operator=(const pooled_stream&) = delete;
+
+    multi_process_stream& stream() { return *stream_; }
+    multi_process_stream* operator->() { return stream_; }
+
+private:
+    multi_process_stream* stream_;
+};
 }  // namespace serialization
 
 // SERIALIZATION-HeaderTest-Exclude: multi_process_stream.h
@@ -7,13 +7,18 @@
 
 // NB: This Registry works poorly when you have other namespaces.
 // Make all macro invocations from inside the at namespace.
+#include <cstdint>
 #include <functional>
 #include <mutex>
+#include <shared_mutex>
+#include <typeinfo>
 #include <vector>
 
 #include "util/macros.h"
 #include "util/exception.h"
+#include "util/export.h"
 #include "util/flat_hash.h"
+#include "util/string_util.h"
 
 namespace serialization
 {
@@ -25,22 +30,60 @@ public:
 
     void Register(const KeyType& key, Function f)
     {
-        std::lock_guard<std::mutex> lock(register_mutex_);
-        registry_[key] = f;
+        const uint64_t                      hash = key_hash(key);
+        std::unique_lock<std::shared_mutex> lock(register_mutex_);
+
+        // Keys are stored by their FNV-1a hash; the name is retained for
+        // Keys() and so a (vanishingly unlikely) collision between two
+        // distinct registered names fails loudly instead of silently
+        // dispatching to the wrong serializer.
+        const auto it = names_.find(hash);
+        if (it != names_.end() && it->second != key)
+        {
+            throw std::runtime_error("Registry key hash collision");
+        }
+
+        registry_[hash] = f;
+        names_[hash]    = key;
+    }
+
+    inline bool Has(const KeyType& key)
+    {
+        const uint64_t                      hash = key_hash(key);
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        return (registry_.count(hash) != 0);
     }
 
-    inline bool Has(const KeyType& key) { return (registry_.count(key) != 0); }
+    /**
+     * Returns the registered function for @a key in a single lookup, or
+     * nullptr when none is registered. The key is hashed once and probes
+     * compare 8-byte integers, so long demangled type names are never
+     * re-compared on the hot path. Concurrent lookups only take the
+     * shared side of the lock; the handle stays valid until the next
+     * Register call.
+     */
+    [[nodiscard]] const Function* find(const KeyType& key)
+    {
+        const uint64_t                      hash = key_hash(key);
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        const auto                          it = registry_.find(hash);
+        return it != registry_.end() ? &it->second : nullptr;
+    }
 
     template <class Arg1, class Arg2, class... Args>
     auto run(const KeyType& key, Arg1& arg1, Arg2* arg2, Args... args)
     {
-        return registry_[key](arg1, arg2, args...);
+        const uint64_t                      hash = key_hash(key);
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        return registry_.at(hash)(arg1, arg2, args...);
     }
 
     template <class Arg1, class Arg2, class... Args>
     auto run(const KeyType& key, Arg1& arg1, Arg2& arg2, Args... args)
     {
-        return registry_[key](arg1, arg2, args...);
+        const uint64_t                      hash = key_hash(key);
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        return registry_.at(hash)(arg1, arg2, args...);
     }
 
     /**
@@ -48,10 +91,11 @@ public:
      */
     std::vector<KeyType> Keys() const
     {
-        std::vector<KeyType> keys;
-        for (const auto& it : registry_)
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        std::vector<KeyType>                keys;
+        for (const auto& it : names_)
         {
-            keys.push_back(it.first);
+            keys.push_back(it.second);
         }
         return keys;
     }
@@ -60,8 +104,22 @@ public:
     Registry& operator=(const Registry& /*rhs*/) = delete;
 
 private:
-    quarisma::quarisma_map<KeyType, Function> registry_{};
-    std::mutex                                register_mutex_;
+    template <typename K>
+    [[nodiscard]] static uint64_t key_hash(const K& key)
+    {
+        if constexpr (std::is_convertible_v<const K&, std::string_view>)
+        {
+            return quarisma::fnv1a(std::string_view(key));
+        }
+        else
+        {
+            return static_cast<uint64_t>(std::hash<K>{}(key));
+        }
+    }
+
+    quarisma::quarisma_map<uint64_t, Function> registry_{};
+    quarisma::quarisma_map<uint64_t, KeyType>  names_{};
+    mutable std::shared_mutex                  register_mutex_;
 };
 
 template <class KeyType, typename Function>
@@ -73,6 +131,64 @@ public:
         registry->Register(key, method);
     }
 };
+
+//-----------------------------------------------------------------------------
+// Deferred registration
+//-----------------------------------------------------------------------------
+// Registering thousands of types at static-init time used to demangle
+// every type name and take the registry lock once per type per archiver.
+// The macro-based registrars now only link a node holding the type_info
+// and the callback into an intrusive list — no demangling, no locking,
+// no map — and the registry bulk-builds its table from that list on
+// first use.
+
+/// @brief One pending macro registration: type, callback, list link.
+template <typename Function>
+struct deferred_registration
+{
+    const std::type_info*            type;
+    Function                         method;
+    deferred_registration<Function>* next;
+};
+
+/// @brief Static-init registrar that enqueues instead of registering.
+/// Construction runs during static initialization, before threads exist,
+/// so pushing onto the intrusive list needs no synchronization.
+template <typename Function>
+class DeferredRegisterer
+{
+public:
+    explicit DeferredRegisterer(
+        const std::type_info&             type,
+        deferred_registration<Function>*& head,
+        Function                          method)
+        : entry_{&type, std::move(method), head}
+    {
+        head = &entry_;
+    }
+
+private:
+    deferred_registration<Function> entry_;
+};
+
+/// @brief Builds a registry from the pending list in one pass.
+/// Demangling and table construction happen here, on the first registry
+/// use, instead of once per Registerer at startup. Registrations made
+/// after the first use must call Register directly.
+template <typename Function>
+Registry<std::string, Function>* build_deferred_registry(deferred_registration<Function>*& head)
+{
+    auto* registry = new Registry<std::string, Function>();
+    for (auto* entry = head; entry != nullptr; entry = entry->next)
+    {
+        // demangled_name both names the key and seeds the process-wide
+        // type-name cache, so later saves of registered types never
+        // demangle.
+        registry->Register(demangled_name(*entry->type), entry->method);
+    }
+    head = nullptr;
+    return registry;
+}
 /**
  * @brief A template class that allows one to register classes by keys.
  *
@@ -95,20 +211,26 @@ public:
 
     void Register(const KeyType& key, Function f)
     {
-        std::lock_guard<std::mutex> lock(register_mutex_);
+        std::unique_lock<std::shared_mutex> lock(register_mutex_);
         registry_[key] = f;
     }
 
-    inline bool Has(const KeyType& key) { return (registry_.count(key) != 0); }
+    inline bool Has(const KeyType& key)
+    {
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        return (registry_.count(key) != 0);
+    }
 
     ReturnType run(const KeyType& key, Args... args)
     {
-        if (registry_.count(key) == 0)
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        const auto                          it = registry_.find(key);
+        if (it == registry_.end())
         {
             // Returns nullptr if the key is not registered.
             return nullptr;
         }
-        return registry_[key](args...);
+        return it->second(args...);
     }
 
     /**
@@ -116,7 +238,8 @@ public:
      */
     std::vector<KeyType> Keys() const
     {
-        std::vector<KeyType> keys;
+        std::shared_lock<std::shared_mutex> lock(register_mutex_);
+        std::vector<KeyType>                keys;
         for (const auto& it : registry_)
         {
             keys.push_back(it.first);
@@ -129,7 +252,7 @@ public:
 
 private:
     quarisma::quarisma_map<KeyType, Function> registry_{};
-    std::mutex                                register_mutex_;
+    mutable std::shared_mutex                 register_mutex_;
 };
 
 template <class KeyType, class ReturnType, class... Args>
@@ -152,20 +275,27 @@ public:
 };
 }  // namespace creator
 
-#define SERIALIZATION_DECLARE_FUNCTION_REGISTRY(RegistryName, Function) \
-    serialization::Registry<std::string, Function>* RegistryName();     \
-    using Registerer##RegistryName = serialization::Registerer<std::string, Function>;
-
-#define SERIALIZATION_DEFINE_FUNCTION_REGISTRY(RegistryName, Function)                \
-    serialization::Registry<std::string, Function>* RegistryName()                    \
-    {                                                                          \
-        static auto* registry = new serialization::Registry<std::string, Function>(); \
-        return registry;                                                       \
+#define SERIALIZATION_DECLARE_FUNCTION_REGISTRY(RegistryName, Function)                         \
+    serialization::Registry<std::string, Function>* RegistryName();                             \
+    SERIALIZATION_API serialization::deferred_registration<Function>*& RegistryName##Pending(); \
+    using Registerer##RegistryName = serialization::DeferredRegisterer<Function>;
+
+#define SERIALIZATION_DEFINE_FUNCTION_REGISTRY(RegistryName, Function)                   \
+    serialization::deferred_registration<Function>*& RegistryName##Pending()             \
+    {                                                                                    \
+        static serialization::deferred_registration<Function>* head = nullptr;           \
+        return head;                                                                     \
+    }                                                                                    \
+    serialization::Registry<std::string, Function>* RegistryName()                       \
+    {                                                                                    \
+        static auto* registry =                                                          \
+            serialization::build_deferred_registry<Function>(RegistryName##Pending());   \
+        return registry;                                                                 \
     }
 
 #define SERIALIZATION_REGISTER_FUNCTION(RegistryName, type, Function)                   \
     static Registerer##RegistryName SERIALIZATION_ANONYMOUS_VARIABLE(g_##RegistryName)( \
-        demangle(typeid(type).name()), RegistryName(), Function);
+        typeid(type), RegistryName##Pending(), Function);
 
 #define SERIALIZATION_DECLARE_TYPED_REGISTRY(RegistryName, KeyType, ObjectType, PtrType, ...)      \
     serialization::creator::Registry<KeyType, PtrType<ObjectType>, ##__VA_ARGS__>* RegistryName(); \
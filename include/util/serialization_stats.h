@@ -0,0 +1,173 @@
+#pragma once
+
+/**
+ * Compile-time-optional instrumentation counters for the serialization
+ * hot paths.
+ *
+ * Define SERIALIZATION_ENABLE_STATS=1 (see util/configure.h) to have
+ * serializer_impl and the access facade record per-operation counters:
+ * archive bytes, objects saved/loaded by class name, registry lookups,
+ * tracked pointer allocations, and wall time per top-level field. The
+ * struct for the most recent operation on the calling thread is
+ * retrievable through access::last_operation_stats().
+ *
+ * When the switch is off every hook below is an empty inline function,
+ * so the instrumented call sites compile to nothing.
+ */
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "util/configure.h"
+
+#if SERIALIZATION_ENABLE_STATS
+#include <chrono>
+#endif
+
+namespace serialization
+{
+/**
+ * @brief Counters recorded across one facade operation (one save or
+ *        load of a top-level object and everything it reaches).
+ */
+struct serialization_stats
+{
+    /** Total bytes in the produced (save) or consumed (load) archive. */
+    uint64_t archive_bytes{0};
+
+    /** Reflectable objects visited, keyed by demangled class name. */
+    std::map<std::string, uint64_t> objects_by_class;
+
+    /** Polymorphic registry lookups performed. */
+    uint64_t registry_lookups{0};
+
+    /** Objects allocated while loading through tracked pointers. */
+    uint64_t pointer_allocations{0};
+
+    /** Wall time spent in each top-level field of the root object, in
+     *  encounter order. Nested fields accrue to their top-level parent. */
+    std::vector<std::pair<std::string, double>> field_seconds;
+
+    void clear()
+    {
+        archive_bytes = 0;
+        objects_by_class.clear();
+        registry_lookups    = 0;
+        pointer_allocations = 0;
+        field_seconds.clear();
+    }
+};
+
+namespace detail
+{
+#if SERIALIZATION_ENABLE_STATS
+
+//----------------------------------------------------------------------------
+inline serialization_stats& thread_stats()
+{
+    thread_local serialization_stats stats;
+    return stats;
+}
+
+//----------------------------------------------------------------------------
+inline void stats_begin_operation()
+{
+    thread_stats().clear();
+}
+
+//----------------------------------------------------------------------------
+inline void stats_archive_bytes(uint64_t bytes)
+{
+    thread_stats().archive_bytes = bytes;
+}
+
+//----------------------------------------------------------------------------
+inline void stats_count_object(std::string_view class_name)
+{
+    ++thread_stats().objects_by_class[std::string(class_name)];
+}
+
+//----------------------------------------------------------------------------
+inline void stats_count_registry_lookup()
+{
+    ++thread_stats().registry_lookups;
+}
+
+//----------------------------------------------------------------------------
+inline void stats_count_pointer_allocation()
+{
+    ++thread_stats().pointer_allocations;
+}
+
+/**
+ * @brief RAII timer that attributes the scope's wall time to one
+ *        top-level field. Only the outermost instance on the thread
+ *        records, so nested reflection walks accrue to their root field.
+ */
+class stats_field_timer
+{
+public:
+    explicit stats_field_timer(std::string_view field_name)
+    {
+        if (depth_()++ != 0)
+        {
+            return;
+        }
+        name_  = field_name;
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    ~stats_field_timer()
+    {
+        if (--depth_() != 0 || name_.empty())
+        {
+            return;
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        thread_stats().field_seconds.emplace_back(
+            name_, std::chrono::duration<double>(stop - start_).count());
+    }
+
+    stats_field_timer(const stats_field_timer&)            = delete;
+    stats_field_timer& operator=(const stats_field_timer&) = delete;
+
+private:
+    static int& depth_()
+    {
+        thread_local int depth = 0;
+        return depth;
+    }
+
+    std::string_view                      name_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+#else  // !SERIALIZATION_ENABLE_STATS
+
+//----------------------------------------------------------------------------
+// Compiled-out hooks: empty inline functions the optimizer removes.
+inline serialization_stats& thread_stats()
+{
+    static serialization_stats stats;
+    return stats;
+}
+
+inline void stats_begin_operation() {}
+inline void stats_archive_bytes(uint64_t) {}
+inline void stats_count_object(std::string_view) {}
+inline void stats_count_registry_lookup() {}
+inline void stats_count_pointer_allocation() {}
+
+class stats_field_timer
+{
+public:
+    explicit stats_field_timer(std::string_view) {}
+};
+
+#endif  // SERIALIZATION_ENABLE_STATS
+}  // namespace detail
+}  // namespace serialization
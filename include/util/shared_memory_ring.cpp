@@ -0,0 +1,336 @@
+#include "util/shared_memory_ring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <utility>
+
+#include "util/multi_process_stream.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace serialization
+{
+/**
+ * Shared segment layout: this header followed by capacity payload
+ * bytes. head/tail are monotonically increasing byte counts (never
+ * wrapped); a cursor modulo capacity gives the ring offset, and
+ * tail - head is the number of unread bytes.
+ */
+struct shared_memory_ring::ring_header
+{
+    static constexpr uint32_t magic_value = 0x53524E47U;  // "SRNG"
+
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    uint64_t              capacity;
+    uint32_t              magic;
+};
+
+namespace
+{
+//----------------------------------------------------------------------------
+void* map_segment(const std::string& name, size_t total, bool create, void*& mapping_handle)
+{
+#ifdef _WIN32
+    HANDLE mapping;
+    if (create)
+    {
+        mapping = CreateFileMappingA(
+            INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(total >> 32U),
+            static_cast<DWORD>(total & 0xFFFFFFFFU), name.c_str());
+    }
+    else
+    {
+        mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name.c_str());
+    }
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, create ? total : 0);
+    if (view == nullptr)
+    {
+        CloseHandle(mapping);
+        return nullptr;
+    }
+    mapping_handle = mapping;
+    return view;
+#else
+    (void)mapping_handle;
+    const int fd =
+        create ? ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0600) : ::shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+    if (create && ::ftruncate(fd, static_cast<off_t>(total)) != 0)
+    {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    void* view = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    // The mapping keeps its own reference to the segment.
+    ::close(fd);
+
+    return view == MAP_FAILED ? nullptr : view;
+#endif
+}
+}  // namespace
+
+//----------------------------------------------------------------------------
+shared_memory_ring shared_memory_ring::create(const std::string& name, size_t capacity)
+{
+    shared_memory_ring ring;
+    const size_t       total = sizeof(ring_header) + capacity;
+
+    void* mapping_handle = nullptr;
+    void* view           = map_segment(name, total, true, mapping_handle);
+    if (view == nullptr)
+    {
+        return ring;
+    }
+
+    auto* header     = new (view) ring_header;
+    header->head     = 0;
+    header->tail     = 0;
+    header->capacity = capacity;
+    header->magic    = ring_header::magic_value;
+
+    ring.header_      = header;
+    ring.mapped_size_ = total;
+    ring.name_        = name;
+    ring.owner_       = true;
+#ifdef _WIN32
+    ring.mapping_handle_ = mapping_handle;
+#endif
+    return ring;
+}
+
+//----------------------------------------------------------------------------
+shared_memory_ring shared_memory_ring::open(const std::string& name)
+{
+    shared_memory_ring ring;
+
+    // Map the header first to learn the capacity, then remap in full.
+    void* mapping_handle = nullptr;
+    void* view           = map_segment(name, sizeof(ring_header), false, mapping_handle);
+    if (view == nullptr)
+    {
+        return ring;
+    }
+
+    const auto* probe = static_cast<const ring_header*>(view);
+    if (probe->magic != ring_header::magic_value)
+    {
+#ifdef _WIN32
+        UnmapViewOfFile(view);
+        CloseHandle(mapping_handle);
+#else
+        ::munmap(view, sizeof(ring_header));
+#endif
+        return ring;
+    }
+
+    const size_t total = sizeof(ring_header) + static_cast<size_t>(probe->capacity);
+#ifdef _WIN32
+    UnmapViewOfFile(view);
+    CloseHandle(mapping_handle);
+#else
+    ::munmap(view, sizeof(ring_header));
+#endif
+    mapping_handle = nullptr;
+    view           = map_segment(name, total, false, mapping_handle);
+    if (view == nullptr)
+    {
+        return ring;
+    }
+
+    ring.header_      = static_cast<ring_header*>(view);
+    ring.mapped_size_ = total;
+    ring.name_        = name;
+#ifdef _WIN32
+    ring.mapping_handle_ = mapping_handle;
+#endif
+    return ring;
+}
+
+//----------------------------------------------------------------------------
+shared_memory_ring::shared_memory_ring(shared_memory_ring&& other) noexcept
+{
+    header_      = std::exchange(other.header_, nullptr);
+    mapped_size_ = std::exchange(other.mapped_size_, 0);
+    name_        = std::move(other.name_);
+    owner_       = std::exchange(other.owner_, false);
+    scratch_     = std::move(other.scratch_);
+#ifdef _WIN32
+    mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+}
+
+//----------------------------------------------------------------------------
+shared_memory_ring& shared_memory_ring::operator=(shared_memory_ring&& other) noexcept
+{
+    if (&other != this)
+    {
+        release();
+        header_      = std::exchange(other.header_, nullptr);
+        mapped_size_ = std::exchange(other.mapped_size_, 0);
+        name_        = std::move(other.name_);
+        owner_       = std::exchange(other.owner_, false);
+        scratch_     = std::move(other.scratch_);
+#ifdef _WIN32
+        mapping_handle_ = std::exchange(other.mapping_handle_, nullptr);
+#endif
+    }
+    return (*this);
+}
+
+//----------------------------------------------------------------------------
+shared_memory_ring::~shared_memory_ring()
+{
+    release();
+}
+
+//----------------------------------------------------------------------------
+void shared_memory_ring::release()
+{
+    if (header_ == nullptr)
+    {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(header_);
+    CloseHandle(mapping_handle_);
+    mapping_handle_ = nullptr;
+#else
+    ::munmap(header_, mapped_size_);
+    if (owner_)
+    {
+        ::shm_unlink(name_.c_str());
+    }
+#endif
+    header_      = nullptr;
+    mapped_size_ = 0;
+    owner_       = false;
+}
+
+//----------------------------------------------------------------------------
+size_t shared_memory_ring::capacity() const
+{
+    return header_ != nullptr ? static_cast<size_t>(header_->capacity) : 0;
+}
+
+//----------------------------------------------------------------------------
+unsigned char* shared_memory_ring::payload() const
+{
+    return reinterpret_cast<unsigned char*>(header_) + sizeof(ring_header);
+}
+
+//----------------------------------------------------------------------------
+bool shared_memory_ring::write(const unsigned char* data, size_t size)
+{
+    if (header_ == nullptr)
+    {
+        return false;
+    }
+
+    const uint64_t capacity = header_->capacity;
+    const uint64_t record   = sizeof(uint64_t) + size;
+    const uint64_t tail     = header_->tail.load(std::memory_order_relaxed);
+    const uint64_t head     = header_->head.load(std::memory_order_acquire);
+    if (record > capacity - (tail - head))
+    {
+        return false;
+    }
+
+    // Copy with wraparound: the length prefix first, then the payload.
+    const auto push = [this, capacity](uint64_t cursor, const unsigned char* bytes, size_t count)
+    {
+        const size_t offset = static_cast<size_t>(cursor % capacity);
+        const size_t first  = std::min(count, static_cast<size_t>(capacity) - offset);
+        std::memcpy(payload() + offset, bytes, first);
+        std::memcpy(payload(), bytes + first, count - first);
+    };
+
+    uint64_t length = size;
+    push(tail, reinterpret_cast<const unsigned char*>(&length), sizeof(uint64_t));
+    push(tail + sizeof(uint64_t), data, size);
+
+    header_->tail.store(tail + record, std::memory_order_release);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool shared_memory_ring::read(std::vector<unsigned char>& out)
+{
+    if (header_ == nullptr)
+    {
+        return false;
+    }
+
+    const uint64_t capacity = header_->capacity;
+    const uint64_t head     = header_->head.load(std::memory_order_relaxed);
+    const uint64_t tail     = header_->tail.load(std::memory_order_acquire);
+    if (tail == head)
+    {
+        return false;
+    }
+
+    const auto pop = [this, capacity](uint64_t cursor, unsigned char* bytes, size_t count)
+    {
+        const size_t offset = static_cast<size_t>(cursor % capacity);
+        const size_t first  = std::min(count, static_cast<size_t>(capacity) - offset);
+        std::memcpy(bytes, payload() + offset, first);
+        std::memcpy(bytes + first, payload(), count - first);
+    };
+
+    uint64_t length = 0;
+    pop(head, reinterpret_cast<unsigned char*>(&length), sizeof(uint64_t));
+
+    out.resize(static_cast<size_t>(length));
+    pop(head + sizeof(uint64_t), out.data(), out.size());
+
+    header_->head.store(head + sizeof(uint64_t) + length, std::memory_order_release);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool shared_memory_ring::write_archive(const multi_process_stream& stream)
+{
+    if (header_ == nullptr)
+    {
+        return false;
+    }
+
+    // One record holding the SetRawData layout: payload then endianness.
+    const auto view = stream.GetRawDataView();
+    scratch_.reserve(view.size() + 1);
+    scratch_.assign(view.begin(), view.end());
+    scratch_.push_back(stream.endianness());
+    return write(scratch_.data(), scratch_.size());
+}
+
+//----------------------------------------------------------------------------
+bool shared_memory_ring::read_archive(multi_process_stream& stream)
+{
+    if (!read(scratch_))
+    {
+        return false;
+    }
+    stream.SetRawData(scratch_.data(), scratch_.size());
+    return true;
+}
+}  // namespace serialization
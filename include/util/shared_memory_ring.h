@@ -0,0 +1,121 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @class   shared_memory_ring
+ * @brief   Lock-free SPSC byte ring in a named shared-memory segment.
+ *
+ * Hands length-prefixed records from one producer process to one
+ * consumer process through a shared mapping, so archives cross the
+ * process boundary without the GetRawData/IPC/SetRawData copy chain.
+ * The producer creates the segment (create), the consumer attaches to
+ * it (open); cursors are monotonically increasing atomics published
+ * with release stores and observed with acquire loads, so neither side
+ * ever takes a lock. The protocol is strictly single-producer /
+ * single-consumer.
+ *
+ * write_archive/read_archive frame a multi_process_stream's raw bytes
+ * (payload plus endianness byte) as one record, so the stream formats
+ * carry over unchanged. When the platform cannot provide the segment
+ * valid() returns false and every operation is a no-op returning false.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "util/export.h"
+
+namespace serialization
+{
+class multi_process_stream;
+
+class SERIALIZATION_API shared_memory_ring
+{
+public:
+    /**
+     * Creates (or re-initializes) the named segment with room for
+     * @a capacity payload bytes and returns the producer-side handle.
+     * The segment name follows the platform's shared-memory naming
+     * rules (a leading '/' on POSIX). The creating handle removes the
+     * name again in its destructor.
+     */
+    static shared_memory_ring create(const std::string& name, size_t capacity);
+
+    /**
+     * Attaches to an existing segment and returns the consumer-side
+     * handle; valid() is false when the segment does not exist or was
+     * not initialized by create().
+     */
+    static shared_memory_ring open(const std::string& name);
+
+    shared_memory_ring(shared_memory_ring&& other) noexcept;
+    shared_memory_ring& operator=(shared_memory_ring&& other) noexcept;
+    ~shared_memory_ring();
+
+    shared_memory_ring(const shared_memory_ring&)            = delete;
+    shared_memory_ring& operator=(const shared_memory_ring&) = delete;
+
+    [[nodiscard]] bool   valid() const { return header_ != nullptr; }
+    [[nodiscard]] size_t capacity() const;
+
+    /**
+     * Producer side: appends one record of @a size bytes. Returns false
+     * without blocking when the ring lacks space for the record and its
+     * length prefix; the producer decides whether to retry or drop.
+     */
+    bool write(const unsigned char* data, size_t size);
+
+    /**
+     * Consumer side: pops the next record into @a out (replacing its
+     * contents). Returns false without blocking when the ring is empty.
+     */
+    bool read(std::vector<unsigned char>& out);
+
+    //@{
+    /**
+     * Archive framing. write_archive records the stream's unread payload
+     * followed by its endianness byte, matching the SetRawData layout.
+     * read_archive pops the next record and hands it to @a stream via the
+     * borrowing SetRawData overload: the bytes stay in this handle's
+     * scratch buffer and remain valid until the next read or destruction.
+     */
+    bool write_archive(const multi_process_stream& stream);
+    bool read_archive(multi_process_stream& stream);
+    //@}
+
+private:
+    shared_memory_ring() = default;
+
+    struct ring_header;
+
+    [[nodiscard]] unsigned char* payload() const;
+
+    void release();
+
+    ring_header* header_{nullptr};
+    size_t       mapped_size_{0};
+    std::string  name_;
+    bool         owner_{false};
+
+    std::vector<unsigned char> scratch_;
+#ifdef _WIN32
+    void* mapping_handle_{nullptr};
+#endif
+};
+}  // namespace serialization
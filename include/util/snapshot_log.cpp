@@ -0,0 +1,210 @@
+#include "util/snapshot_log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <stdexcept>
+#include <utility>
+
+#include "util/byte_swap.h"
+
+namespace serialization
+{
+namespace
+{
+constexpr char   kLogMagic[4]  = {'S', 'L', 'G', '1'};
+constexpr size_t kHeaderBytes  = sizeof(kLogMagic) + 1;
+
+unsigned char host_endianness()
+{
+    const uint16_t probe = 1;
+    unsigned char  first;
+    std::memcpy(&first, &probe, 1);
+    return first;
+}
+
+template <typename Word>
+void append_word(std::string& out, Word value)
+{
+    char bytes[sizeof(Word)];
+    std::memcpy(bytes, &value, sizeof(Word));
+    out.append(bytes, sizeof(Word));
+}
+
+template <typename Word>
+bool read_word(std::ifstream& in, bool swap, Word& value)
+{
+    char bytes[sizeof(Word)];
+    if (!in.read(bytes, sizeof(Word)))
+    {
+        return false;
+    }
+    std::memcpy(&value, bytes, sizeof(Word));
+    if (swap)
+    {
+        value = byte_swap(value);
+    }
+    return true;
+}
+
+/**
+ * Reads the header and streams records through @a consume until the
+ * file ends or a record is torn; returns the offset just past the last
+ * complete record. @a consume may be empty when only the scan position
+ * is wanted.
+ */
+template <typename Consume>
+uint64_t scan_records(std::ifstream& in, Consume&& consume)
+{
+    char header[kHeaderBytes];
+    if (!in.read(header, kHeaderBytes) ||
+        std::memcmp(header, kLogMagic, sizeof(kLogMagic)) != 0)
+    {
+        throw std::runtime_error("snapshot_log: file is not a snapshot log");
+    }
+    const bool swap = static_cast<unsigned char>(header[sizeof(kLogMagic)]) !=
+                      host_endianness();
+
+    uint64_t good_end = kHeaderBytes;
+    while (true)
+    {
+        snapshot_log::record entry;
+        uint32_t             key_size = 0;
+        uint64_t             payload_size = 0;
+        if (!read_word(in, swap, entry.index) || !read_word(in, swap, key_size))
+        {
+            break;
+        }
+
+        entry.key.resize(key_size);
+        if (!in.read(entry.key.data(), key_size) || !read_word(in, swap, payload_size))
+        {
+            break;
+        }
+
+        entry.payload.resize(payload_size);
+        if (!in.read(
+                reinterpret_cast<char*>(entry.payload.data()),
+                static_cast<std::streamsize>(payload_size)))
+        {
+            break;
+        }
+
+        good_end = static_cast<uint64_t>(in.tellg());
+        consume(std::move(entry));
+    }
+    return good_end;
+}
+}  // namespace
+
+//----------------------------------------------------------------------------
+snapshot_log::snapshot_log(const std::string& path)
+{
+    std::error_code probe_error;
+    const bool      exists = std::filesystem::exists(path, probe_error) &&
+                        std::filesystem::file_size(path, probe_error) > 0;
+
+    if (exists)
+    {
+        // Resume the index sequence from the existing records; a torn
+        // final record from a crashed append is cut off so the log
+        // reopens at a clean boundary.
+        std::ifstream in(path, std::ios::binary);
+        uint64_t      highest = 0;
+        bool          any     = false;
+        const uint64_t good_end = scan_records(
+            in,
+            [&highest, &any](record&& entry)
+            {
+                highest = entry.index > highest ? entry.index : highest;
+                any     = true;
+            });
+        in.close();
+
+        if (good_end < std::filesystem::file_size(path))
+        {
+            std::filesystem::resize_file(path, good_end);
+        }
+        next_index_ = any ? highest + 1 : 0;
+        out_.open(path, std::ios::binary | std::ios::app);
+        return;
+    }
+
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    out_.write(kLogMagic, sizeof(kLogMagic));
+    const char endianness = static_cast<char>(host_endianness());
+    out_.write(&endianness, 1);
+}
+
+//----------------------------------------------------------------------------
+void snapshot_log::append(std::string_view key, const std::vector<unsigned char>& payload)
+{
+    // One framed record, staged so the file sees a single write.
+    std::string frame;
+    frame.reserve(sizeof(uint64_t) * 2 + sizeof(uint32_t) + key.size() + payload.size());
+    append_word(frame, next_index_);
+    append_word(frame, static_cast<uint32_t>(key.size()));
+    frame.append(key.data(), key.size());
+    append_word(frame, static_cast<uint64_t>(payload.size()));
+    frame.append(reinterpret_cast<const char*>(payload.data()), payload.size());
+
+    out_.write(frame.data(), static_cast<std::streamsize>(frame.size()));
+    ++next_index_;
+}
+
+//----------------------------------------------------------------------------
+void snapshot_log::flush()
+{
+    out_.flush();
+}
+
+//----------------------------------------------------------------------------
+std::vector<snapshot_log::record> snapshot_log::replay_latest(const std::string& path)
+{
+    // Later records under the same key supersede earlier ones.
+    std::map<std::string, record> latest;
+    std::ifstream                 in(path, std::ios::binary);
+    scan_records(
+        in,
+        [&latest](record&& entry)
+        {
+            record& slot = latest[entry.key];
+            if (slot.payload.empty() || entry.index >= slot.index)
+            {
+                slot = std::move(entry);
+            }
+        });
+
+    std::vector<record> records;
+    records.reserve(latest.size());
+    for (auto& [key, entry] : latest)
+    {
+        records.push_back(std::move(entry));
+    }
+    std::sort(
+        records.begin(),
+        records.end(),
+        [](const record& lhs, const record& rhs) { return lhs.index < rhs.index; });
+    return records;
+}
+
+//----------------------------------------------------------------------------
+void snapshot_log::compact(const std::string& path)
+{
+    auto survivors = replay_latest(path);
+
+    // Rewrite into a sibling file and swap it in, so a crash mid-compaction
+    // leaves the original log intact.
+    const std::string staging = path + ".compact";
+    {
+        snapshot_log compacted(staging);
+        for (const auto& entry : survivors)
+        {
+            compacted.append(entry.key, entry.payload);
+        }
+        compacted.flush();
+    }
+    std::filesystem::rename(staging, path);
+}
+}  // namespace serialization
@@ -0,0 +1,105 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @class   snapshot_log
+ * @brief   Log-structured append store for keyed binary archives.
+ *
+ * Snapshot cycles that rewrite a whole archive file pay full write
+ * bandwidth even when almost nothing changed. A snapshot_log instead
+ * appends one framed record per new or changed top-level object — a
+ * monotonically growing record index, the record's key, and the archive
+ * payload — so a cycle writes only its deltas. Replaying keeps the
+ * highest-index record per key, which is the latest state; a compaction
+ * pass rewrites the file with just those survivors and renames it into
+ * place, merging generations offline.
+ *
+ * Layout: a "SLG1" magic plus one endianness byte, then records of
+ * u64 index, u32 key size, key bytes, u64 payload size, payload bytes,
+ * all words in the writer's byte order. Opening for append scans the
+ * existing records once to resume the index sequence; a torn final
+ * record (crash mid-append) is truncated away during that scan, so the
+ * log reopens clean.
+ */
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "util/export.h"
+
+namespace serialization
+{
+class SERIALIZATION_API snapshot_log
+{
+public:
+    /**
+     * One replayed record: the latest payload appended under its key.
+     */
+    struct record
+    {
+        uint64_t                   index{0};
+        std::string                key;
+        std::vector<unsigned char> payload;
+    };
+
+    /**
+     * Opens @a path for appending, creating it (with header) when new.
+     * Throws std::runtime_error when the file exists but is not a
+     * snapshot log.
+     */
+    explicit snapshot_log(const std::string& path);
+
+    snapshot_log(const snapshot_log&)            = delete;
+    snapshot_log& operator=(const snapshot_log&) = delete;
+
+    /**
+     * Appends one record under @a key with the next record index.
+     */
+    void append(std::string_view key, const std::vector<unsigned char>& payload);
+
+    /**
+     * Flushes buffered appends to the file.
+     */
+    void flush();
+
+    /**
+     * Index the next append will carry; monotonic across reopens.
+     */
+    [[nodiscard]] uint64_t next_index() const { return next_index_; }
+
+    /**
+     * Replays the log to its latest state: the highest-index record per
+     * key, ordered by that index. Words written by a foreign byte order
+     * are swapped on the fly.
+     */
+    static std::vector<record> replay_latest(const std::string& path);
+
+    /**
+     * Merges generations offline: rewrites the file with only the
+     * latest record per key, re-indexed from zero, and renames it into
+     * place. No appender may hold the file open across a compaction.
+     */
+    static void compact(const std::string& path);
+
+private:
+    std::ofstream out_;
+    uint64_t      next_index_{0};
+};
+}  // namespace serialization
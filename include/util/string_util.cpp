@@ -18,11 +18,18 @@
 
 #include "util/string_util.h"
 
-#include <cstdio>   // for snprintf, vsnprintf
-#include <cstdlib>  // for strtod, strtof, abs, strtol
-#include <cstring>  // for strlen, memcpy
-#include <string>   // for char_traits, string, operator<<, allocator, operator==, oper...
+#include <array>       // for array
+#include <atomic>      // for atomic
+#include <cstdio>      // for snprintf, vsnprintf
+#include <cstdlib>     // for strtod, strtof, abs, strtol
+#include <cstring>     // for strlen, memcpy
+#include <deque>       // for deque
+#include <functional>  // for function
+#include <memory>      // for unique_ptr
+#include <mutex>       // for mutex, scoped_lock
+#include <string>  // for char_traits, string, operator<<, allocator, operator==, oper...
 #include <string_view>
+#include <typeinfo>  // for type_info
 
 #include "util/macros.h"  // for SERIALIZATION_UNUSED, SERIALIZATION_HAS_CXA_DEMANGLE
 
@@ -87,6 +94,149 @@ std::string demangle(const char* name)
 
     return ret;
 }
+// =============================================================================
+// DEMANGLED TYPE-NAME CACHE
+// =============================================================================
+
+namespace
+{
+/// One cached demangled name; never destroyed or moved once published, so
+/// references handed out stay valid for the process lifetime.
+struct type_name_node
+{
+    const std::type_info* type;
+    std::string           name;
+};
+}  // namespace
+
+namespace
+{
+/// One cached demangle result keyed by the mangled-name pointer.
+struct mangled_name_node
+{
+    const char* key;
+    std::string name;
+};
+}  // namespace
+
+/**
+ * @brief Memoized demangle keyed on the mangled-name pointer
+ * @note type_info names have static storage, so pointer identity is a valid
+ *       key and repeated demangles of the same symbol become one hash probe.
+ *       Same append-only compare-exchange table as demangled_name below:
+ *       readers take acquire loads only and published nodes never move.
+ */
+const std::string& cached_demangle(const char* name)
+{
+    if (name == nullptr || *name == '\0')
+    {
+        static const std::string unknown = "<unknown>";
+        return unknown;
+    }
+
+    constexpr size_t table_size = 1024;
+
+    static std::array<std::atomic<mangled_name_node*>, table_size> table{};
+
+    constexpr size_t mask = table_size - 1;
+    size_t           slot = std::hash<const void*>{}(name) & mask;
+    for (size_t probes = 0; probes < table_size; ++probes)
+    {
+        mangled_name_node* entry = table[slot].load(std::memory_order_acquire);
+        if (entry == nullptr)
+        {
+            auto*              fresh    = new mangled_name_node{name, demangle(name)};
+            mangled_name_node* expected = nullptr;
+            if (table[slot].compare_exchange_strong(
+                    expected, fresh, std::memory_order_release, std::memory_order_acquire))
+            {
+                return fresh->name;
+            }
+            delete fresh;
+            entry = expected;
+        }
+        if (entry->key == name)
+        {
+            return entry->name;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Table exhausted: mutex-guarded overflow, references stay stable.
+    static std::mutex                    overflow_mutex;
+    static std::deque<mangled_name_node> overflow;
+
+    const std::scoped_lock lock(overflow_mutex);
+    for (const auto& entry : overflow)
+    {
+        if (entry.key == name)
+        {
+            return entry.name;
+        }
+    }
+    return overflow.emplace_back(mangled_name_node{name, demangle(name)}).name;
+}
+
+/**
+ * @brief Lock-free process-wide cache of demangled type names
+ * @note The table is append-only: slots go from null to a published node
+ *       exactly once (compare-exchange), and readers only take acquire
+ *       loads, so concurrent saves never contend on a lock. The previous
+ *       per-thread caches demangled every type once per thread and
+ *       returned strings by value.
+ */
+const std::string& demangled_name(const std::type_info& type)
+{
+    // Power of two; comfortably above the number of distinct serialized
+    // types in any deployment we have seen.
+    constexpr size_t table_size = 1024;
+
+    static std::array<std::atomic<type_name_node*>, table_size> table{};
+
+    constexpr size_t mask = table_size - 1;
+    size_t           slot = type.hash_code() & mask;
+    for (size_t probes = 0; probes < table_size; ++probes)
+    {
+        type_name_node* entry = table[slot].load(std::memory_order_acquire);
+        if (entry == nullptr)
+        {
+            auto*           fresh    = new type_name_node{&type, demangle(type.name())};
+            type_name_node* expected = nullptr;
+            if (table[slot].compare_exchange_strong(
+                    expected, fresh, std::memory_order_release, std::memory_order_acquire))
+            {
+                return fresh->name;
+            }
+            // Another thread published this slot first; discard ours and
+            // inspect what it stored.
+            delete fresh;
+            entry = expected;
+        }
+        // Compare type_info values, not pointers: the same type can have
+        // distinct type_info objects across shared-library boundaries.
+        if (*entry->type == type)
+        {
+            return entry->name;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    // Table exhausted: fall back to a mutex-guarded overflow list. Nodes in
+    // a deque never move, so references stay stable here too.
+    static std::mutex                overflow_mutex;
+    static std::deque<type_name_node> overflow;
+
+    const std::scoped_lock lock(overflow_mutex);
+    for (const auto& entry : overflow)
+    {
+        if (*entry.type == type)
+        {
+            return entry.name;
+        }
+    }
+    return overflow.emplace_back(type_name_node{&type, demangle(type.name())}).name;
+}
+
 // =============================================================================
 // STRING MANIPULATION AND REPLACEMENT FUNCTIONS
 // =============================================================================
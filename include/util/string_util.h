@@ -19,14 +19,19 @@ limitations under the License.
 #include <stdarg.h>  // for va_list
 
 #include <algorithm>  // for transform
+#include <array>      // for array (enum lookup tables)
 #include <cctype>
+#include <charconv>     // for to_chars, from_chars
 #include <cstddef>      // for size_t
+#include <optional>     // for optional (enum lookup)
+#include <stdexcept>    // for invalid_argument
 #include <cstdint>      // for int64_t, uint64_t, uint32_t, int32_t
 #include <filesystem>   // for path (C++17)
 #include <iomanip>      // for setfill, setw, hex
 #include <sstream>      // for ostream, ostringstream, stringstream
 #include <string>       // for string, allocator, char_traits, stoi, to_string
 #include <string_view>  // for string_view
+#include <typeinfo>     // for type_info
 #include <vector>       // for vector
 
 #include "util/export.h"  // for SERIALIZATION_API, SERIALIZATION_VISIBILITY
@@ -36,11 +41,129 @@ limitations under the License.
 // ENUM CONVERSION UTILITIES
 // =============================================================================
 
+namespace serialization
+{
+namespace detail
+{
+//----------------------------------------------------------------------------
+// Case-insensitive hashing over ASCII, constexpr so the per-enum lookup
+// tables below are built entirely at compile time.
+constexpr char ascii_lower(char character)
+{
+    return character >= 'A' && character <= 'Z'
+               ? static_cast<char>(character - 'A' + 'a')
+               : character;
+}
+
+constexpr uint64_t ci_hash(std::string_view text)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (const char character : text)
+    {
+        hash ^= static_cast<unsigned char>(ascii_lower(character));
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+constexpr bool ci_equal(std::string_view lhs, std::string_view rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        if (ascii_lower(lhs[i]) != ascii_lower(rhs[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Compile-time hash table mapping enum names to values
+ * @tparam E The enum type
+ * @tparam Entries Reference to a constexpr array of (value, name) pairs
+ * @note Built once at a load factor below one half, so a case-insensitive
+ *       lookup is one hash plus at most a couple of probes instead of a
+ *       linear scan with per-character case folding on every call. The
+ *       entries array is a template argument rather than baked-in
+ *       magic_enum output so the table compiles and is testable without
+ *       the magic_enum dependency
+ */
+template <typename E, const auto& Entries>
+struct enum_lookup
+{
+    static constexpr const auto& entries = Entries;
+
+    static constexpr size_t capacity_for(size_t count)
+    {
+        size_t capacity = 2;
+        while (capacity < count * 2)
+        {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    static constexpr size_t capacity = capacity_for(entries.size());
+
+    struct slot
+    {
+        std::string_view name;
+        E                value{};
+        bool             used{false};
+    };
+
+    static constexpr std::array<slot, capacity> build()
+    {
+        std::array<slot, capacity> table{};
+        for (const auto& [value, name] : entries)
+        {
+            size_t index = ci_hash(name) & (capacity - 1);
+            while (table[index].used)
+            {
+                index = (index + 1) & (capacity - 1);
+            }
+            table[index] = {name, value, true};
+        }
+        return table;
+    }
+
+    static constexpr std::array<slot, capacity> table = build();
+
+    static constexpr std::optional<E> find(std::string_view name)
+    {
+        size_t index = ci_hash(name) & (capacity - 1);
+        while (table[index].used)
+        {
+            if (ci_equal(table[index].name, name))
+            {
+                return table[index].value;
+            }
+            index = (index + 1) & (capacity - 1);
+        }
+        return std::nullopt;
+    }
+};
+}  // namespace detail
+}  // namespace serialization
+
 #if SERIALIZATION_HAS_MAGICENUM
 #include <magic_enum/magic_enum.hpp>
 
 namespace serialization
 {
+namespace detail
+{
+//----------------------------------------------------------------------------
+// One table instance per enum type, seeded from magic_enum reflection.
+template <typename E>
+inline constexpr auto enum_entries = magic_enum::enum_entries<E>();
+}  // namespace detail
+
 /**
  * @brief Convert an enum value to its string representation using magic_enum
  * @tparam E The enum type
@@ -60,12 +183,14 @@ inline std::string_view enum_to_string(E x)
 }
 
 /**
- * @brief Convert a string to an enum value using magic_enum (case-insensitive)
+ * @brief Convert a string to an enum value (case-insensitive)
  * @tparam E The enum type
  * @param str The string to convert
  * @return The corresponding enum value
  * @throws std::bad_optional_access if the string doesn't match any enum value
- * @note This function performs case-insensitive matching
+ * @note One probe of a compile-time hash table built from
+ *       magic_enum::enum_entries; archives carry tens of millions of enum
+ *       fields, so the per-call linear scan of enum_cast was measurable
  * @example
  * @code
  * enum class Color { Red, Green, Blue };
@@ -75,7 +200,7 @@ inline std::string_view enum_to_string(E x)
 template <typename E>
 E string_to_enum(std::string_view str)
 {
-    return magic_enum::enum_cast<E>(str, magic_enum::case_insensitive).value();
+    return detail::enum_lookup<E, detail::enum_entries<E>>::find(str).value();
 }
 }  // namespace serialization
 #else
@@ -87,14 +212,18 @@ namespace serialization
  * @param x The enum value to convert
  * @return String view containing the numeric representation
  * @note This is a fallback implementation when magic_enum is not available
- * @warning Uses serialization_thread_local storage for performance
+ * @warning Uses thread-local storage for performance
  */
 template <typename E>
 inline std::string_view enum_to_string(E x)
 {
-    static thread_local std::string buffer;
-    buffer = std::to_string(static_cast<int>(x));
-    return buffer;
+    // to_chars into a fixed buffer: no allocation per call.
+    static thread_local char buffer[24];
+    const auto               result = std::to_chars(
+        buffer,
+        buffer + sizeof(buffer),
+        static_cast<long long>(static_cast<std::underlying_type_t<E>>(x)));
+    return {buffer, static_cast<size_t>(result.ptr - buffer)};
 }
 
 /**
@@ -104,11 +233,19 @@ inline std::string_view enum_to_string(E x)
  * @return The corresponding enum value
  * @throws std::invalid_argument if the string is not a valid integer
  * @note This is a fallback implementation when magic_enum is not available
+ * @note from_chars on the view directly: the previous stoi path built a
+ *       temporary std::string per call
  */
 template <typename E>
 E string_to_enum(std::string_view str)
 {
-    return static_cast<E>(std::stoi(std::string(str)));
+    long long value = 0;
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec != std::errc() || ptr != str.data() + str.size())
+    {
+        throw std::invalid_argument("string_to_enum: '" + std::string(str) + "' is not numeric");
+    }
+    return static_cast<E>(value);
 }
 }  // namespace serialization
 #endif
@@ -133,6 +270,29 @@ namespace serialization
  */
 SERIALIZATION_API std::string demangle(const char* name);
 
+/**
+ * @brief Memoized demangle keyed on the mangled-name pointer
+ * @param name The mangled symbol name (typically from typeid().name())
+ * @return Reference to the cached demangled name; stable for the process lifetime
+ * @note type_info names are stable for the process, so the pointer itself is
+ *       the key and a hit costs one hash probe with no allocation. Lookups
+ *       are lock-free on an append-only atomic table, matching demangled_name
+ * @note Prefer this over demangle() anywhere the same name can recur —
+ *       registration loops, per-object type naming, logging
+ */
+SERIALIZATION_API const std::string& cached_demangle(const char* name);
+
+/**
+ * @brief Process-wide cache of demangled names keyed by type_info
+ * @param type The type_info to name (typically typeid(*obj))
+ * @return Reference to the cached demangled name; stable for the process lifetime
+ * @note Lookups are lock-free on an append-only atomic table, so concurrent
+ *       save threads share one cache instead of demangling per thread
+ * @note The registries seed this cache for every registered type, so the
+ *       save hot path neither demangles nor allocates
+ */
+SERIALIZATION_API const std::string& demangled_name(const std::type_info& type);
+
 /**
  * @brief Get the printable name of a type using RTTI
  * @tparam T The type to get the name for
@@ -0,0 +1,115 @@
+#include "util/xml_arena.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include <pugixml.hpp>
+
+namespace serialization
+{
+namespace
+{
+// Every block handed to pugixml is preceded by one max-aligned header
+// unit whose first byte records where the block came from, so the
+// deallocation hook can tell arena blocks (reclaimed wholesale) from
+// heap blocks (freed individually) regardless of which arena, if any,
+// is active at destruction time.
+constexpr size_t kBlockHeader = alignof(std::max_align_t);
+
+thread_local xml_document_arena* active_arena = nullptr;
+
+// Referencing any xml_document_arena symbol links this translation unit
+// in, and with it this initializer, so the hooks are in place before
+// any document that could meet an arena allocates.
+const bool hooks_installed = []
+{
+    xml_document_arena::install_hooks();
+    return true;
+}();
+}  // namespace
+
+//----------------------------------------------------------------------------
+void xml_document_arena::install_hooks()
+{
+    pugi::set_memory_management_functions(&allocate_hook, &deallocate_hook);
+}
+
+//----------------------------------------------------------------------------
+xml_document_arena::xml_document_arena(size_t page_size) : page_size_(page_size)
+{
+    previous_    = active_arena;
+    active_arena = this;
+}
+
+//----------------------------------------------------------------------------
+xml_document_arena::~xml_document_arena()
+{
+    active_arena = previous_;
+    for (void* page : pages_)
+    {
+        std::free(page);
+    }
+}
+
+//----------------------------------------------------------------------------
+void* xml_document_arena::allocate_hook(size_t size)
+{
+    const bool from_arena = active_arena != nullptr;
+
+    auto* block = static_cast<unsigned char*>(
+        from_arena ? active_arena->allocate(kBlockHeader + size)
+                   : std::malloc(kBlockHeader + size));
+    if (block == nullptr)
+    {
+        return nullptr;
+    }
+
+    block[0] = from_arena ? 1 : 0;
+    return block + kBlockHeader;
+}
+
+//----------------------------------------------------------------------------
+void xml_document_arena::deallocate_hook(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    auto* block = static_cast<unsigned char*>(ptr) - kBlockHeader;
+    if (block[0] == 0)
+    {
+        std::free(block);
+    }
+    // Arena blocks stay put; their pages are released in the arena
+    // destructor.
+}
+
+//----------------------------------------------------------------------------
+void* xml_document_arena::allocate(size_t size)
+{
+    size = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    if (size > remaining_)
+    {
+        // Oversize requests (pugixml's parse buffer is the whole file)
+        // get a page of their own instead of bumping the page size.
+        const size_t page_bytes = std::max(size, page_size_);
+        void*        page       = std::malloc(page_bytes);
+        if (page == nullptr)
+        {
+            return nullptr;
+        }
+        pages_.push_back(page);
+        cursor_    = static_cast<unsigned char*>(page);
+        remaining_ = page_bytes;
+    }
+
+    void* block = cursor_;
+    cursor_ += size;
+    remaining_ -= size;
+    allocated_bytes_ += size;
+    return block;
+}
+}  // namespace serialization
@@ -0,0 +1,89 @@
+/* Copyright 2018 The Serialization Authors. All Rights Reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+==============================================================================*/
+
+#pragma once
+
+/**
+ * @class   xml_document_arena
+ * @brief   Per-document bump allocation for pugixml node memory.
+ *
+ * pugixml requests all of its memory (node pages and the parse buffer)
+ * through a pair of process-wide allocation functions. Parsing many
+ * documents concurrently therefore contends on the global heap and
+ * fragments it with page-sized blocks of mixed lifetime. While an
+ * xml_document_arena is alive on a thread, every pugixml allocation made
+ * on that thread is carved out of the arena's pages instead; the blocks
+ * are reclaimed wholesale when the arena is destroyed, and the
+ * intervening per-node frees become no-ops.
+ *
+ * The arena must outlive every document parsed under it: declare the
+ * arena before the pugi::xml_document in the same scope so the document
+ * is destroyed first. Arenas nest per thread (the innermost one is
+ * active) and other threads are unaffected.
+ *
+ * The replacement allocation functions are installed for the whole
+ * process when this translation unit is loaded, before any document can
+ * allocate through them. Each block carries a small header recording
+ * its origin, so documents built on threads without an active arena
+ * keep ordinary heap behaviour and can be destroyed under any arena (or
+ * none).
+ */
+
+#include <cstddef>
+#include <vector>
+
+#include "util/export.h"
+
+namespace serialization
+{
+class SERIALIZATION_API xml_document_arena
+{
+public:
+    explicit xml_document_arena(size_t page_size = 1 << 16);
+    ~xml_document_arena();
+
+    xml_document_arena(const xml_document_arena&)            = delete;
+    xml_document_arena& operator=(const xml_document_arena&) = delete;
+    xml_document_arena(xml_document_arena&&)                 = delete;
+    xml_document_arena& operator=(xml_document_arena&&)      = delete;
+
+    /**
+     * Total bytes carved out of the arena so far, headers and alignment
+     * padding included.
+     */
+    size_t allocated_bytes() const { return allocated_bytes_; }
+
+    /**
+     * Installs the pugixml allocation hooks. Runs automatically during
+     * static initialization of this translation unit; exposed so
+     * embedders that parse documents during their own static
+     * initialization can order the installation ahead of them.
+     */
+    static void install_hooks();
+
+private:
+    static void* allocate_hook(size_t size);
+    static void  deallocate_hook(void* ptr);
+
+    void* allocate(size_t size);
+
+    std::vector<void*>  pages_;
+    unsigned char*      cursor_{nullptr};
+    size_t              remaining_{0};
+    size_t              page_size_;
+    size_t              allocated_bytes_{0};
+    xml_document_arena* previous_{nullptr};
+};
+}  // namespace serialization